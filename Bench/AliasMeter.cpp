@@ -0,0 +1,34 @@
+#include "AliasMeter.h"
+#include "../WavetableGenerator/DSP/FrequencyProcessorFactory.h"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		void AliasMeter::FillSine(float* frame, size_t numSamples, int harmonic, float amplitude) {
+			const double PI = 3.14159265358979323846;
+			for (size_t i = 0; i < numSamples; ++i)
+				frame[i] = (float)(amplitude * std::sin(2.0 * PI * harmonic * (double)i / (double)numSamples));
+		}
+
+		double AliasMeter::AliasToHarmonicDb(const float* frame, size_t numSamples, int harmonic) {
+			std::unique_ptr<DSP::IFrequencyProcessor> fft = DSP::FrequencyProcessorFactory::Create((int)numSamples);
+			std::vector<DSP::ComplexBin> bins(numSamples / 2 + 1);
+			fft->ForwardBatch(frame, bins.data(), 1);
+
+			double harmonicEnergy = 0.0;
+			double aliasEnergy = 0.0;
+			for (size_t k = 1; k < bins.size(); ++k) {
+				double energy = (double)std::norm(bins[k]);
+				if (k % (size_t)harmonic == 0)
+					harmonicEnergy += energy;
+				else
+					aliasEnergy += energy;
+			}
+
+			// The floor keeps a clean frame finite (about the float32 FFT's own noise)
+			return 10.0 * std::log10(aliasEnergy / harmonicEnergy + 1e-15);
+		}
+	}
+}
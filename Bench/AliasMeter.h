@@ -0,0 +1,23 @@
+#ifndef ALIASMETER_H
+#define ALIASMETER_H
+
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Bench {
+		// Alias energy of a nonlinearity driven by a sine that is exactly periodic in the frame:
+		// after the nonlinearity every bin at a multiple of the sine's harmonic is a true harmonic
+		// and every other bin is aliasing folded back from above Nyquist
+		class AliasMeter {
+		public:
+			// One frame of amplitude * sin(2 pi harmonic n / numSamples)
+			static void FillSine(float* frame, size_t numSamples, int harmonic, float amplitude);
+
+			// Energy of the non-harmonic bins relative to the harmonic bins, in dB (DC ignored)
+			// numSamples: a power of two
+			static double AliasToHarmonicDb(const float* frame, size_t numSamples, int harmonic);
+		};
+	}
+}
+
+#endif // ALIASMETER_H
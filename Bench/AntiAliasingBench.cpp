@@ -0,0 +1,80 @@
+#include "Benchmark.h"
+#include "AliasMeter.h"
+#include "../WavetableGenerator/DSP/WaveformEffects.h"
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		using namespace Core;
+
+		// ADAA against the oversampled paths: alias energy of a full-scale sine (frames are
+		// normalized to +-1 before the effects run) at several harmonics of a 2048-sample frame,
+		// and the time to process one frame
+		WTG_BENCHMARK(AntiAliasingModes, "ADAA vs oversampling: alias energy and time per frame") {
+			const size_t numSamples = 2048;
+			const int harmonics[] = { 37, 101, 211, 401 };
+
+			const struct {
+				const char* name;
+				DistortionType type;
+				float amount;
+				float fold;
+			} effects[] = {
+				{ "hard 0.7", DistortionType::Hard, 0.7f, 0.0f },
+				{ "asym 0.7", DistortionType::Asymmetric, 0.7f, 0.0f },
+				{ "soft 0.7", DistortionType::Soft, 0.7f, 0.0f },
+				{ "fold 0.8", DistortionType::None, 0.0f, 0.8f }
+			};
+
+			const struct {
+				const char* name;
+				AntiAliasing antiAliasing;
+				OversamplingQuality quality;
+			} modes[] = {
+				{ "OS Standard", AntiAliasing::Oversampling, OversamplingQuality::Standard },
+				{ "OS Maximum", AntiAliasing::Oversampling, OversamplingQuality::Maximum },
+				{ "Periodic Std", AntiAliasing::PeriodicOversampling, OversamplingQuality::Standard },
+				{ "ADAA1", AntiAliasing::ADAA1, OversamplingQuality::Standard },
+				{ "ADAA2", AntiAliasing::ADAA2, OversamplingQuality::Standard }
+			};
+
+			std::printf("%-9s %-13s %6s", "effect", "mode", "factor");
+			for (int h : harmonics) std::printf("  h=%-5d", h);
+			std::printf(" %10s\n", "us/frame");
+
+			std::vector<float> input(numSamples);
+			std::vector<float> frame(numSamples);
+			for (const auto& effect : effects) {
+				for (const auto& mode : modes) {
+					WaveformEffects::NonlinearStage stage;
+					stage.distortionType = effect.type;
+					stage.distortionAmount = effect.amount;
+					stage.wavefoldAmount = effect.fold;
+					stage.antiAliasing = mode.antiAliasing;
+					stage.quality = mode.quality;
+
+					bool adaa = mode.antiAliasing == AntiAliasing::ADAA1 || mode.antiAliasing == AntiAliasing::ADAA2;
+					std::printf("%-9s %-13s", effect.name, mode.name);
+					if (adaa)
+						std::printf(" %6s", "-");
+					else
+						std::printf(" %5dx", stage.GetOversamplingFactor());
+
+					for (int h : harmonics) {
+						AliasMeter::FillSine(frame.data(), numSamples, h, 1.0f);
+						WaveformEffects::ApplyNonlinearStage(frame.data(), numSamples, stage);
+						std::printf("  %7.1f", AliasMeter::AliasToHarmonicDb(frame.data(), numSamples, h));
+					}
+
+					AliasMeter::FillSine(input.data(), numSamples, harmonics[0], 1.0f);
+					double us = BestTimeMicroseconds(50, [&]() {
+						frame = input;
+						WaveformEffects::ApplyNonlinearStage(frame.data(), numSamples, stage);
+					});
+					std::printf(" %10.1f\n", us);
+				}
+			}
+		}
+	}
+}
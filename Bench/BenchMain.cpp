@@ -0,0 +1,68 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace WavetableGen {
+	namespace Bench {
+		std::vector<BenchmarkEntry>& GetBenchmarks() {
+			static std::vector<BenchmarkEntry> benchmarks;
+			return benchmarks;
+		}
+
+		BenchmarkRegistrar::BenchmarkRegistrar(const char* name, const char* description, BenchmarkFunction run) {
+			BenchmarkEntry entry;
+			entry.name = name;
+			entry.description = description;
+			entry.run = run;
+			GetBenchmarks().push_back(entry);
+		}
+
+		double BestTimeMicroseconds(int repeats, const std::function<void()>& body) {
+			double best = 0.0;
+			for (int i = 0; i < repeats; ++i) {
+				auto start = std::chrono::steady_clock::now();
+				body();
+				std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+				if (i == 0 || elapsed.count() < best) best = elapsed.count();
+			}
+			return best;
+		}
+	}
+}
+
+// Usage: WavetableGeneratorBench [--list] [name...]
+int main(int argc, char** argv) {
+	using namespace WavetableGen::Bench;
+
+	std::vector<BenchmarkEntry> benchmarks = GetBenchmarks();
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry& a, const BenchmarkEntry& b) {
+		return std::strcmp(a.name, b.name) < 0;
+	});
+
+	if (argc > 1 && std::strcmp(argv[1], "--list") == 0) {
+		for (const BenchmarkEntry& benchmark : benchmarks)
+			std::printf("%-24s %s\n", benchmark.name, benchmark.description);
+		return 0;
+	}
+
+	int run = 0;
+	for (const BenchmarkEntry& benchmark : benchmarks) {
+		bool selected = argc == 1;
+		for (int i = 1; i < argc && !selected; ++i)
+			selected = std::strcmp(argv[i], benchmark.name) == 0;
+		if (!selected) continue;
+
+		std::printf("== %s: %s\n", benchmark.name, benchmark.description);
+		benchmark.run();
+		std::printf("\n");
+		++run;
+	}
+
+	if (run == 0) {
+		std::fprintf(stderr, "No benchmark matches; --list shows the names\n");
+		return 1;
+	}
+	return 0;
+}
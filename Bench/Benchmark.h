@@ -0,0 +1,39 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <functional>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		// Console benchmarks behind the timings and error figures quoted in the doc comments
+		// Every benchmark prints its own table. WavetableGeneratorBench runs all of them, or the
+		// ones named on the command line; build Release x64 for meaningful numbers.
+		typedef void (*BenchmarkFunction)();
+
+		struct BenchmarkEntry {
+			const char* name;
+			const char* description;
+			BenchmarkFunction run;
+		};
+
+		// Every benchmark linked into the executable
+		std::vector<BenchmarkEntry>& GetBenchmarks();
+
+		// Adds a benchmark to GetBenchmarks() during static initialization (see WTG_BENCHMARK)
+		struct BenchmarkRegistrar {
+			BenchmarkRegistrar(const char* name, const char* description, BenchmarkFunction run);
+		};
+
+		// Fastest of 'repeats' runs of body, in microseconds (the minimum filters out preemption)
+		double BestTimeMicroseconds(int repeats, const std::function<void()>& body);
+	}
+}
+
+// Define and register a benchmark: WTG_BENCHMARK(Name, "what it measures") { ... }
+#define WTG_BENCHMARK(name, description) \
+	static void name(); \
+	static ::WavetableGen::Bench::BenchmarkRegistrar name##Registrar(#name, description, name); \
+	static void name()
+
+#endif // BENCHMARK_H
@@ -0,0 +1,210 @@
+#include "Benchmark.h"
+#include "../WavetableGenerator/Core/ChaosEngine.h"
+#include "../WavetableGenerator/Core/WaveGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		using namespace Core;
+
+		namespace {
+			// Reference: the chaos waves as WaveGenerator::GenerateWave rendered them before
+			// ChaosEngine, restarting the integration from the initial state for every sample
+			void RenderRestarting(WaveType type, float* output, size_t numSamples) {
+				for (size_t n = 0; n < numSamples; ++n) {
+					double t = (double)n / numSamples;
+
+					switch (type) {
+					case WaveType::Lorenz: {
+						float sigma = 10.0f, rho = 28.0f, beta = 8.0f / 3.0f;
+						float x = 0.1f, y = 0.0f, z = 0.0f;
+						float dt_sim = 0.01f;
+						int steps = (int)(t * 200.0f);
+						for (int s = 0; s < steps; ++s) {
+							float dx = sigma * (y - x);
+							float dy = x * (rho - z) - y;
+							float dz = x * y - beta * z;
+							x += dx * dt_sim;
+							y += dy * dt_sim;
+							z += dz * dt_sim;
+						}
+						output[n] = std::tanh(x / 15.0f);
+						break;
+					}
+
+					case WaveType::Rossler: {
+						float a = 0.2f, b = 0.2f, c = 5.7f;
+						float x = 0.1f, y = 0.0f, z = 0.0f;
+						float dt_sim = 0.05f;
+						int steps = (int)(t * 100.0f);
+						for (int s = 0; s < steps; ++s) {
+							float dx = -y - z;
+							float dy = x + a * y;
+							float dz = b + z * (x - c);
+							x += dx * dt_sim;
+							y += dy * dt_sim;
+							z += dz * dt_sim;
+						}
+						output[n] = std::tanh(x / 5.0f);
+						break;
+					}
+
+					case WaveType::Henon: {
+						float a = 1.4f, b = 0.3f;
+						float x = 0.1f, y = 0.1f;
+						int iterations = (int)(t * 50.0f);
+						for (int i = 0; i < iterations; ++i) {
+							float xnew = 1.0f - a * x * x + y;
+							y = b * x;
+							x = xnew;
+						}
+						output[n] = std::tanh(x);
+						break;
+					}
+
+					case WaveType::Duffing: {
+						float alpha = -1.0f, beta = 1.0f, delta = 0.3f, gamma = 0.37f, omega = 1.2f;
+						float x = 0.1f, v = 0.0f;
+						float dt_sim = 0.05f;
+						float time = (float)t * 10.0f;
+						for (float t_sim = 0; t_sim < time; t_sim += dt_sim) {
+							float force = gamma * (float)cos(omega * t_sim);
+							float dv = -delta * v - alpha * x - beta * x * x * x + force;
+							v += dv * dt_sim;
+							x += v * dt_sim;
+						}
+						output[n] = std::tanh(x);
+						break;
+					}
+
+					case WaveType::Chua: {
+						float alpha = 15.6f, beta = 28.0f;
+						float x = 0.1f, y = 0.0f, z = 0.0f;
+						float dt_sim = 0.01f;
+						int steps = (int)(t * 150.0f);
+						for (int s = 0; s < steps; ++s) {
+							float h = -1.143f * x + 0.714f * (std::abs(x + 1.0f) - std::abs(x - 1.0f));
+							float dx = alpha * (y - x - h);
+							float dy = x - y + z;
+							float dz = -beta * y;
+							x += dx * dt_sim;
+							y += dy * dt_sim;
+							z += dz * dt_sim;
+						}
+						output[n] = std::tanh(x / 2.0f);
+						break;
+					}
+
+					case WaveType::LogisticChaos: {
+						float r = 3.9f;
+						float x = 0.5f;
+						int iterations = (int)(t * 100.0f) + 50;
+						for (int i = 0; i < iterations; ++i) {
+							x = r * x * (1.0f - x);
+						}
+						output[n] = (x - 0.5f) * 2.0f;
+						break;
+					}
+
+					default:
+						output[n] = 0.0f;
+						break;
+					}
+				}
+			}
+		}
+
+		// One cycle of every chaos kernel against the restarting reference, then a 512-frame morph
+		// between two chaos mixes: rendered frame by frame with either kernel (every wave of every
+		// frame from scratch, as the generator did before the wave cache), and through
+		// WaveGenerator written as a .wt file. Each generator run starts from an empty wave cache,
+		// so the basis cycles are rendered every time rather than looked up.
+		WTG_BENCHMARK(ChaosEngine, "Restarting vs single-pass chaos kernels: per cycle and a 512-frame morph") {
+			typedef void (*RenderFunction)(float*, size_t);
+			const struct {
+				const char* name;
+				WaveType type;
+				RenderFunction render;
+			} kernels[] = {
+				{ "Lorenz", WaveType::Lorenz, ChaosEngine::RenderLorenz },
+				{ "Rossler", WaveType::Rossler, ChaosEngine::RenderRossler },
+				{ "Henon", WaveType::Henon, ChaosEngine::RenderHenon },
+				{ "Duffing", WaveType::Duffing, ChaosEngine::RenderDuffing },
+				{ "Chua", WaveType::Chua, ChaosEngine::RenderChua },
+				{ "LogisticChaos", WaveType::LogisticChaos, ChaosEngine::RenderLogisticChaos }
+			};
+
+			std::vector<float> reference(SAMPLES_PER_WAVE);
+			std::vector<float> cycle(SAMPLES_PER_WAVE);
+			std::printf("%-14s %14s %14s %10s %12s\n", "kernel", "restart us", "1-pass us", "speedup", "max diff");
+			for (const auto& kernel : kernels) {
+				double oldUs = BestTimeMicroseconds(3, [&]() { RenderRestarting(kernel.type, reference.data(), reference.size()); });
+				double newUs = BestTimeMicroseconds(20, [&]() { kernel.render(cycle.data(), cycle.size()); });
+				double maxDiff = 0.0;
+				for (size_t i = 0; i < cycle.size(); ++i)
+					maxDiff = (std::max)(maxDiff, (double)std::abs(cycle[i] - reference[i]));
+				std::printf("%-14s %14.1f %14.1f %9.0fx %12.1e\n", kernel.name, oldUs, newUs, oldUs / newUs, maxDiff);
+			}
+
+			const std::vector<std::pair<WaveType, float>> startWaves = {
+				{ WaveType::Lorenz, 1.0f }, { WaveType::Rossler, 0.7f }, { WaveType::Chua, 0.5f }
+			};
+			const std::vector<std::pair<WaveType, float>> endWaves = {
+				{ WaveType::Duffing, 1.0f }, { WaveType::Henon, 0.6f }, { WaveType::LogisticChaos, 0.4f }
+			};
+			const int numFrames = 512;
+			const char* path = "bench_chaos.wt";
+
+			// Linear morph, one cycle per wave with a non-zero weight: the three start waves in
+			// the first frame, the three end waves in the last and all six in between
+			std::vector<float> table(numFrames * SAMPLES_PER_WAVE);
+			auto renderTable = [&](bool restart) {
+				for (int frame = 0; frame < numFrames; ++frame) {
+					float morph = (float)frame / (numFrames - 1);
+					float* output = table.data() + frame * SAMPLES_PER_WAVE;
+					std::fill(output, output + SAMPLES_PER_WAVE, 0.0f);
+					for (int side = 0; side < 2; ++side) {
+						for (const auto& wave : side == 0 ? startWaves : endWaves) {
+							float weight = wave.second * (side == 0 ? 1.0f - morph : morph);
+							if (weight <= 0.0f) continue;
+							if (restart) {
+								RenderRestarting(wave.first, cycle.data(), cycle.size());
+							}
+							else {
+								for (const auto& kernel : kernels) {
+									if (kernel.type == wave.first) kernel.render(cycle.data(), cycle.size());
+								}
+							}
+							for (size_t i = 0; i < cycle.size(); ++i)
+								output[i] += weight * cycle[i];
+						}
+					}
+				}
+			};
+
+			double restartUs = BestTimeMicroseconds(1, [&]() { renderTable(true); });
+			double singlePassUs = BestTimeMicroseconds(5, [&]() { renderTable(false); });
+			std::printf("512-frame chaos morph, every wave per frame, restarting kernels: %.1f ms\n", restartUs / 1000.0);
+			std::printf("512-frame chaos morph, every wave per frame, single-pass kernels: %.1f ms (%.0fx)\n",
+				singlePassUs / 1000.0, restartUs / singlePassUs);
+
+			GenerationResult result = GenerationResult::Success;
+			double us = BestTimeMicroseconds(5, [&]() {
+				WaveGenerator generator(std::make_shared<WaveCache>());
+				result = generator.GenerateWavetable(startWaves, endWaves, path, OutputFormat::WT, false, true, numFrames);
+			});
+			std::remove(path);
+
+			if (result != GenerationResult::Success) {
+				std::printf("512-frame chaos morph failed (result %d)\n", (int)result);
+				return;
+			}
+			std::printf("512-frame chaos morph, WaveGenerator with the wave cache, .wt written: %.1f ms (%.0fx)\n",
+				us / 1000.0, restartUs / us);
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+#include "../WavetableGenerator/DSP/FastFFTProcessor.h"
+#include "../WavetableGenerator/DSP/KissFFTProcessor.h"
+#include "../WavetableGenerator/Utils/CpuFeatures.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		namespace {
+			// Microseconds per forward + inverse transform of one frame
+			double TimeRoundTrip(DSP::IFrequencyProcessor& processor, std::vector<float>& frame) {
+				const size_t n = frame.size();
+				std::vector<DSP::ComplexBin> bins(n / 2 + 1);
+				const int reps = (int)(std::max)((size_t)16, (size_t)262144 / n);
+
+				double us = BestTimeMicroseconds(5, [&]() {
+					for (int i = 0; i < reps; ++i) {
+						processor.ForwardBatch(frame.data(), bins.data(), 1);
+						processor.InverseBatch(bins.data(), frame.data(), 1);
+					}
+				});
+				return us / reps;
+			}
+		}
+
+		// FastFFTProcessor at every instruction set the CPU supports against KissFFTProcessor
+		WTG_BENCHMARK(FFT, "Fast vs Kiss FFT: forward + inverse time per frame") {
+			using Utils::SimdLevel;
+			const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 };
+			const SimdLevel best = Utils::CpuFeatures::GetSimdLevel();
+
+			std::printf("%6s %10s", "N", "kiss");
+			for (SimdLevel level : levels) {
+				if (level <= best) std::printf(" %10s", Utils::CpuFeatures::GetSimdLevelName(level));
+			}
+			std::printf("   (us per forward + inverse; speedup of the best level)\n");
+
+			for (int n = 256; n <= 16384; n *= 2) {
+				std::vector<float> frame(n);
+				for (int i = 0; i < n; ++i)
+					frame[i] = (float)((i * 7919) % 2001) / 1000.0f - 1.0f;
+
+				DSP::KissFFTProcessor kiss(n);
+				double kissUs = TimeRoundTrip(kiss, frame);
+				std::printf("%6d %10.2f", n, kissUs);
+
+				double fastestUs = kissUs;
+				for (SimdLevel level : levels) {
+					if (level > best) continue;
+					DSP::FastFFTProcessor fast(n, level);
+					double us = TimeRoundTrip(fast, frame);
+					fastestUs = (std::min)(fastestUs, us);
+					std::printf(" %10.2f", us);
+				}
+				std::printf("   %.1fx\n", kissUs / fastestUs);
+			}
+		}
+	}
+}
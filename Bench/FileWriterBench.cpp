@@ -0,0 +1,50 @@
+#include "Benchmark.h"
+#include "../WavetableGenerator/IO/WTFileWriter.h"
+#include "../WavetableGenerator/IO/WAVFileWriter.h"
+#include "../WavetableGenerator/Core/WaveGenerator.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		using namespace Core;
+
+		// Throughput of the .wt and .wav writers on a 512-frame table, including the file write
+		// (written to the working directory and removed afterwards)
+		WTG_BENCHMARK(FileWriters, "WT and WAV writer throughput on a 512-frame table") {
+			const int numFrames = 512;
+			std::vector<float> samples((size_t)numFrames * SAMPLES_PER_WAVE);
+			for (size_t i = 0; i < samples.size(); ++i)
+				samples[i] = 1.3f * std::sin(0.0123f * (float)i);  // Partly out of range: exercises the clamp
+
+			IO::WTFileWriter wtWriter;
+			IO::WAVFileWriter wavWriter;
+			const struct {
+				const char* name;
+				const char* path;
+				IO::IFileWriter* writer;
+				size_t bytesPerSample;
+			} formats[] = {
+				{ "WT", "bench_writer.wt", &wtWriter, 4 },
+				{ "WAV", "bench_writer.wav", &wavWriter, 2 }
+			};
+
+			std::printf("%-4s %8s %10s %10s\n", "fmt", "MB", "ms", "MB/s");
+			for (const auto& format : formats) {
+				GenerationResult result = GenerationResult::Success;
+				double us = BestTimeMicroseconds(7, [&]() {
+					result = format.writer->Write(format.path, samples, numFrames, SAMPLE_RATE);
+				});
+				std::remove(format.path);
+
+				if (result != GenerationResult::Success) {
+					std::printf("%-4s write failed (result %d)\n", format.name, (int)result);
+					continue;
+				}
+				double megabytes = (double)(samples.size() * format.bytesPerSample) / 1e6;
+				std::printf("%-4s %8.1f %10.2f %10.0f\n", format.name, megabytes, us / 1000.0, megabytes / (us / 1e6));
+			}
+		}
+	}
+}
@@ -0,0 +1,123 @@
+#include "Benchmark.h"
+#include "AliasMeter.h"
+#include "../WavetableGenerator/DSP/Oversampler.h"
+#include "../WavetableGenerator/DSP/PeriodicResampler.h"
+#include "../WavetableGenerator/DSP/WaveshaperKernels.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		using namespace Core;
+
+		namespace {
+			const size_t TABLE_FRAME_SIZE = 2048;
+			const int TABLE_HARMONIC = 101;  // A tenth of the base-rate Nyquist
+			const int TABLE_FACTORS[] = { 1, 2, 4, 8 };
+			const float TABLE_AMPLITUDES[] = { 0.25f, 0.5f, 0.75f, 1.0f };
+			const int AMOUNT_STEPS = 8;      // Amounts measured between two rows
+
+			// Alias energy of one stage at one oversampling factor, through the resampler of the
+			// given mode (AntiAliasing::Oversampling: polyphase, PeriodicOversampling: periodic)
+			double MeasureAliasDb(const WaveformEffects::NonlinearStage& stage, int factor, float amplitude, AntiAliasing mode) {
+				std::vector<float> frame(TABLE_FRAME_SIZE);
+				std::vector<float> oversampled(TABLE_FRAME_SIZE * factor);
+				AliasMeter::FillSine(frame.data(), frame.size(), TABLE_HARMONIC, amplitude);
+				const WaveshaperParams params = WaveshaperParams::FromStage(stage);
+
+				if (factor == 1) {
+					WaveshaperKernels::ProcessScalar(frame.data(), frame.size(), params);
+				}
+				else if (mode == AntiAliasing::PeriodicOversampling) {
+					DSP::PeriodicResampler resampler(TABLE_FRAME_SIZE, factor);
+					resampler.Upsample(frame.data(), oversampled.data());
+					WaveshaperKernels::ProcessScalar(oversampled.data(), oversampled.size(), params);
+					resampler.Downsample(oversampled.data(), frame.data());
+				}
+				else {
+					DSP::Oversampler resampler(factor);
+					std::vector<float> scratch(resampler.GetScratchSize(TABLE_FRAME_SIZE));
+					resampler.Upsample(frame.data(), TABLE_FRAME_SIZE, oversampled.data(), scratch.data());
+					WaveshaperKernels::ProcessScalar(oversampled.data(), oversampled.size(), params);
+					resampler.Downsample(oversampled.data(), TABLE_FRAME_SIZE, frame.data(), scratch.data());
+				}
+				return AliasMeter::AliasToHarmonicDb(frame.data(), frame.size(), TABLE_HARMONIC);
+			}
+
+			// Print one member of an AliasTables initializer: each row holds the worst alias energy
+			// over every test amplitude and every amount above the previous row up to its own,
+			// which is the range WaveformEffects' FactorFor judges by that row
+			template <typename MakeStage>
+			void PrintRows(const char* label, const float* rows, size_t numRows, bool integerAmounts, AntiAliasing mode,
+				bool last, MakeStage makeStage) {
+				std::printf("\t// %s\n\t{\n", label);
+				float previous = integerAmounts ? 0.0f : 0.001f - 1e-6f;
+				for (size_t row = 0; row < numRows; ++row) {
+					double worst[4] = { -1000.0, -1000.0, -1000.0, -1000.0 };
+					int steps = integerAmounts ? (int)(rows[row] - previous) : AMOUNT_STEPS;
+					for (int step = 1; step <= steps; ++step) {
+						float amount = previous + (rows[row] - previous) * (float)step / (float)steps;
+						for (float amplitude : TABLE_AMPLITUDES) {
+							for (int i = 0; i < 4; ++i)
+								worst[i] = (std::max)(worst[i], MeasureAliasDb(makeStage(amount), TABLE_FACTORS[i], amplitude, mode));
+						}
+					}
+					const char* format = integerAmounts
+						? "\t\t{ %.1ff, { %.1ff, %.1ff, %.1ff, %.1ff } }%s\n"
+						: "\t\t{ %.2ff, { %.1ff, %.1ff, %.1ff, %.1ff } }%s\n";
+					std::printf(format, rows[row], worst[0], worst[1], worst[2], worst[3], row + 1 < numRows ? "," : "");
+					previous = rows[row];
+				}
+				std::printf("\t}%s\n", last ? "" : ",");
+			}
+
+			// Print the AliasTables initializer of one resampler
+			void PrintTables(const char* name, AntiAliasing mode) {
+				const float amounts[] = { 0.02f, 0.05f, 0.10f, 0.25f, 0.50f, 0.75f, 1.00f };
+				const size_t numAmounts = sizeof(amounts) / sizeof(amounts[0]);
+
+				std::printf("const AliasTables %s = {\n", name);
+				PrintRows("Soft", amounts, numAmounts, false, mode, false, [](float amount) {
+					WaveformEffects::NonlinearStage stage;
+					stage.distortionType = DistortionType::Soft;
+					stage.distortionAmount = amount;
+					return stage;
+				});
+				PrintRows("Hard", amounts, numAmounts, false, mode, false, [](float amount) {
+					WaveformEffects::NonlinearStage stage;
+					stage.distortionType = DistortionType::Hard;
+					stage.distortionAmount = amount;
+					return stage;
+				});
+				PrintRows("Asymmetric", amounts, numAmounts, false, mode, false, [](float amount) {
+					WaveformEffects::NonlinearStage stage;
+					stage.distortionType = DistortionType::Asymmetric;
+					stage.distortionAmount = amount;
+					return stage;
+				});
+				PrintRows("Wavefold", amounts, numAmounts, false, mode, false, [](float amount) {
+					WaveformEffects::NonlinearStage stage;
+					stage.wavefoldAmount = amount;
+					return stage;
+				});
+
+				// Amount: bits removed (16 - bit depth)
+				const float bitsRemoved[] = { 1.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 15.0f };
+				PrintRows("Bit crush", bitsRemoved, sizeof(bitsRemoved) / sizeof(bitsRemoved[0]), true, mode, true, [](float amount) {
+					WaveformEffects::NonlinearStage stage;
+					stage.bitDepth = 16 - (int)(amount + 0.5f);
+					return stage;
+				});
+				std::printf("};\n\n");
+			}
+		}
+
+		// Regenerates the alias tables WaveformEffects::NonlinearStage::GetOversamplingFactor
+		// picks the factor from (DSP/WaveformEffects.cpp), one set per resampler
+		WTG_BENCHMARK(OversamplingTables, "Alias tables behind the per-effect oversampling factor") {
+			PrintTables("POLYPHASE_ALIASING", AntiAliasing::Oversampling);
+			PrintTables("PERIODIC_ALIASING", AntiAliasing::PeriodicOversampling);
+		}
+	}
+}
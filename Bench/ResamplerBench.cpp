@@ -0,0 +1,54 @@
+#include "Benchmark.h"
+#include "../WavetableGenerator/DSP/Oversampler.h"
+#include "../WavetableGenerator/DSP/PeriodicResampler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Bench {
+		// Polyphase Oversampler against PeriodicResampler at 4x: time to upsample and downsample
+		// one band-limited saw cycle, and the round-trip error of each
+		WTG_BENCHMARK(PeriodicResampling, "Periodic vs polyphase 4x resampling: time and round-trip error") {
+			const int factor = 4;
+			const double PI = 3.14159265358979323846;
+
+			std::printf("%6s %12s %12s %12s %12s %10s %12s %12s\n", "N", "poly up", "poly down",
+				"periodic up", "per. down", "ratio", "poly err", "periodic err");
+
+			for (size_t n : { 256, 512, 1024, 2048, 4096 }) {
+				// Saw with harmonics up to half the base-rate Nyquist
+				std::vector<float> input(n);
+				for (size_t i = 0; i < n; ++i) {
+					double s = 0.0;
+					for (size_t k = 1; k <= n / 4; ++k)
+						s += std::sin(2.0 * PI * (double)(k * i) / (double)n) / (double)k;
+					input[i] = (float)(0.5 * s);
+				}
+
+				std::vector<float> oversampled(n * factor);
+				std::vector<float> output(n);
+				DSP::Oversampler polyphase(factor);
+				std::vector<float> scratch(polyphase.GetScratchSize(n));
+				DSP::PeriodicResampler periodic(n, factor);
+
+				double polyUp = BestTimeMicroseconds(200, [&]() { polyphase.Upsample(input.data(), n, oversampled.data(), scratch.data()); });
+				double polyDown = BestTimeMicroseconds(200, [&]() { polyphase.Downsample(oversampled.data(), n, output.data(), scratch.data()); });
+				double polyError = 0.0;
+				for (size_t i = 0; i < n; ++i)
+					polyError = (std::max)(polyError, (double)std::abs(output[i] - input[i]));
+
+				double periodicUp = BestTimeMicroseconds(200, [&]() { periodic.Upsample(input.data(), oversampled.data()); });
+				double periodicDown = BestTimeMicroseconds(200, [&]() { periodic.Downsample(oversampled.data(), output.data()); });
+				double periodicError = 0.0;
+				for (size_t i = 0; i < n; ++i)
+					periodicError = (std::max)(periodicError, (double)std::abs(output[i] - input[i]));
+
+				double ratio = (periodicUp + periodicDown) / (polyUp + polyDown);
+				std::printf("%6zu %12.1f %12.1f %12.1f %12.1f %9.2fx %12.1e %12.1e\n", n, polyUp, polyDown,
+					periodicUp, periodicDown, ratio, polyError, periodicError);
+			}
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/Core/BasicWaveKernels.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace Core;
+
+		// Every vectorized basic kernel stays within BasicWaveKernels::GetMaxError of the scalar
+		// kernel for N = 3..8192 (every size up to 256, then a stride that hits odd, even and
+		// power-of-2 sizes) and the full range of duties
+		WTG_TEST(BasicWaveKernelsWithinMaxError) {
+			std::vector<size_t> sizes;
+			for (size_t n = 3; n <= 256; ++n) sizes.push_back(n);
+			for (size_t n = 257; n < 8192; n += 61) sizes.push_back(n);
+			for (size_t n = 512; n <= 8192; n *= 2) sizes.push_back(n);
+			const double duties[] = { 0.05, 0.1, 0.3, 0.5, 0.7, 0.9, 0.95 };
+			const int numTypes = static_cast<int>(WaveType::Diphthong) + 1;
+
+			for (int t = 0; t < numTypes; ++t) {
+				const WaveType type = static_cast<WaveType>(t);
+				char what[32];
+				std::snprintf(what, sizeof(what), "wave type %d", t);
+
+				WTG_CHECK_KERNEL_ERROR(what, BasicWaveKernels::GetMaxError(type), [&](Utils::SimdLevel level) {
+					WaveKernel vectorized = BasicWaveKernels::Get(type, level);
+					float worst = 0.0f;
+					if (!vectorized) return worst;  // Rendered by the scalar kernel
+
+					for (size_t numSamples : sizes) {
+						for (double duty : duties) {
+							WaveKernelParams params;
+							params.numSamples = numSamples;
+							params.pulseDuty = duty;
+
+							std::vector<float> expected(numSamples);
+							WaveKernels::GetScalar(type)(expected.data(), params);
+							std::vector<float> actual(numSamples);
+							vectorized(actual.data(), params);
+							worst = (std::max)(worst, MaxDifference(actual, expected, true));
+						}
+					}
+					return worst;
+				});
+			}
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/DSP/EffectChain.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+	// Heap allocations on any thread while counting is on (operator new is replaced below)
+	std::atomic<bool> g_countAllocations(false);
+	std::atomic<size_t> g_allocations(0);
+}
+
+void* operator new(size_t size) {
+	if (g_countAllocations.load(std::memory_order_relaxed)) g_allocations++;
+	if (void* memory = std::malloc(size ? size : 1)) return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	std::free(memory);
+}
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace Core;
+
+		namespace {
+			// Every effect enabled (mirror vertical without invert, which would cancel it out)
+			EffectsSettings AllEffects(AntiAliasing antiAliasing, FilterType filterType) {
+				EffectsSettings settings;
+				settings.distortionType = DistortionType::Soft;
+				settings.distortionAmount = 0.6f;
+				settings.antiAliasing = antiAliasing;
+				settings.enableLowPass = true;
+				settings.lowPassCutoff = 0.5f;
+				settings.enableHighPass = true;
+				settings.highPassCutoff = 0.05f;
+				settings.filterType = filterType;
+				settings.filterResonance = 2.0f;
+				settings.enableBitCrush = true;
+				settings.bitDepth = 10;
+				settings.mirrorHorizontal = true;
+				settings.mirrorVertical = true;
+				settings.reverse = true;
+				settings.enableWavefold = true;
+				settings.wavefoldAmount = 0.4f;
+				settings.enableSpectralDecay = true;
+				settings.spectralDecayAmount = 0.5f;
+				settings.spectralDecayCurve = 2.0f;
+				settings.enableSpectralTilt = true;
+				settings.spectralTiltAmount = 0.3f;
+				settings.enableSpectralGate = true;
+				settings.spectralGateThreshold = 0.01f;
+				settings.enablePhaseRandomize = true;
+				settings.phaseRandomizeAmount = 0.5f;
+				settings.enableSampleRateReduction = true;
+				settings.sampleRateReductionFactor = 2;
+				settings.enableSpectralShift = true;
+				settings.spectralShiftAmount = 3;
+				return settings;
+			}
+		}
+
+		// Once a chain has processed its first frames (thread-local FFT plans and resamplers are
+		// created on first use), Process and ProcessFrames run without heap allocations. At 2048
+		// samples a filter batch fits one FFT chunk, so the batch stays on the calling thread.
+		WTG_TEST(EffectChainDoesNotAllocatePerFrame) {
+			const AntiAliasing modes[] = {
+				AntiAliasing::Oversampling, AntiAliasing::PeriodicOversampling, AntiAliasing::ADAA1, AntiAliasing::ADAA2
+			};
+			const FilterType filterTypes[] = { FilterType::OnePole, FilterType::Biquad, FilterType::StateVariable };
+			const size_t frameSize = 2048;
+			const size_t numFrames = 37;  // Two full filter batches and a partial one
+
+			std::vector<float> frames(frameSize * numFrames);
+			std::vector<uint64_t> seeds(numFrames);
+			for (size_t i = 0; i < numFrames; ++i) seeds[i] = i + 1;
+
+			for (AntiAliasing mode : modes) {
+				for (FilterType filterType : filterTypes) {
+					EffectChain chain(AllEffects(mode, filterType), frameSize);
+					WTG_CHECK(!chain.IsEmpty());
+
+					auto fill = [&]() {
+						for (size_t i = 0; i < frames.size(); ++i)
+							frames[i] = std::sin(0.05f * (float)i) + 0.3f * std::sin(0.31f * (float)i);
+					};
+
+					// Warm-up
+					fill();
+					chain.ProcessFrames(frames.data(), numFrames, seeds.data());
+					chain.Process(frames.data(), 1);
+
+					g_allocations = 0;
+					g_countAllocations = true;
+					for (int repeat = 0; repeat < 3; ++repeat) {
+						fill();
+						chain.ProcessFrames(frames.data(), numFrames, seeds.data());
+						chain.Process(frames.data(), seeds[0]);
+					}
+					g_countAllocations = false;
+
+					if (g_allocations != 0) {
+						char message[128];
+						std::snprintf(message, sizeof(message), "anti-aliasing %d, filter %d: %zu allocations",
+							(int)mode, (int)filterType, g_allocations.load());
+						ReportFailure(__FILE__, __LINE__, message);
+					}
+				}
+			}
+		}
+	}
+}
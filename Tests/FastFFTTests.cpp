@@ -0,0 +1,110 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/DSP/FastFFTProcessor.h"
+#include "../WavetableGenerator/DSP/KissFFTProcessor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace DSP;
+
+		namespace {
+			const int MIN_FFT_SIZE = 2;
+			const int MAX_FFT_SIZE = 16384;
+
+			// Largest difference of a Fast transform from its reference, relative to the reference's
+			// peak magnitude. Float FFTs of random input stay within about 2e-7 of an exact DFT on
+			// that scale at every size, so two of them (or a round trip) stay within this.
+			const double MAX_ERROR = 1e-6;
+
+			std::vector<float> MakeNoise(size_t count, unsigned seed) {
+				std::mt19937 random(seed);
+				std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+				std::vector<float> noise(count);
+				for (float& sample : noise) sample = distribution(random);
+				return noise;
+			}
+
+			template <class T>
+			double PeakRelativeDifference(const std::vector<T>& actual, const std::vector<T>& expected) {
+				if (actual.size() != expected.size()) return INFINITY;
+				double peak = 0.0, difference = 0.0;
+				for (size_t i = 0; i < expected.size(); ++i) {
+					peak = std::max(peak, (double)std::abs(expected[i]));
+					double d = std::abs(actual[i] - expected[i]);
+					if (!(d <= difference)) difference = d; // NaN fails the check
+				}
+				return difference / std::max(peak, 1e-30);
+			}
+		}
+
+		// Forward matches KissFFTProcessor at every size and instruction set
+		WTG_TEST(FastFFTForwardMatchesKiss) {
+			for (int n = MIN_FFT_SIZE; n <= MAX_FFT_SIZE; n *= 2) {
+				const std::vector<float> input = MakeNoise(n, n);
+				KissFFTProcessor kiss(n);
+				std::vector<ComplexBin> expected;
+				kiss.Forward(input, expected);
+
+				char what[32];
+				std::snprintf(what, sizeof(what), "Forward, N = %d", n);
+				WTG_CHECK_KERNEL_ERROR(what, MAX_ERROR, [&](Utils::SimdLevel level) {
+					FastFFTProcessor fast(n, level);
+					std::vector<ComplexBin> actual;
+					fast.Forward(input, actual);
+					return PeakRelativeDifference(actual, expected);
+				});
+			}
+		}
+
+		// Inverse(Forward(x)) gives x back
+		WTG_TEST(FastFFTRoundTrip) {
+			for (int n = MIN_FFT_SIZE; n <= MAX_FFT_SIZE; n *= 2) {
+				const std::vector<float> input = MakeNoise(n, n + 1);
+
+				char what[32];
+				std::snprintf(what, sizeof(what), "Round trip, N = %d", n);
+				WTG_CHECK_KERNEL_ERROR(what, MAX_ERROR, [&](Utils::SimdLevel level) {
+					FastFFTProcessor fast(n, level);
+					std::vector<ComplexBin> spectrum;
+					std::vector<float> output;
+					fast.Forward(input, spectrum);
+					fast.Inverse(spectrum, output);
+					return PeakRelativeDifference(output, input);
+				});
+			}
+		}
+
+		// The batched transforms run the same kernel on each frame: bit-identical to one frame at
+		// a time
+		WTG_TEST(FastFFTBatchMatchesSingleFrames) {
+			const size_t numFrames = 3;
+			for (Utils::SimdLevel level : GetSupportedSimdLevels()) {
+				for (int n = MIN_FFT_SIZE; n <= MAX_FFT_SIZE; n *= 2) {
+					const size_t numBins = n / 2 + 1;
+					const std::vector<float> input = MakeNoise(numFrames * n, n + 2);
+					FastFFTProcessor fast(n, level);
+
+					std::vector<ComplexBin> batchSpectra(numFrames * numBins);
+					fast.ForwardBatch(input.data(), batchSpectra.data(), numFrames);
+					std::vector<float> batchOutput(numFrames * n);
+					fast.InverseBatch(batchSpectra.data(), batchOutput.data(), numFrames);
+
+					for (size_t f = 0; f < numFrames; ++f) {
+						std::vector<float> frame(input.begin() + f * n, input.begin() + (f + 1) * n);
+						std::vector<ComplexBin> spectrum;
+						fast.Forward(frame, spectrum);
+						WTG_CHECK(std::equal(spectrum.begin(), spectrum.end(), batchSpectra.begin() + f * numBins));
+
+						std::vector<float> output;
+						fast.Inverse(spectrum, output);
+						WTG_CHECK(std::equal(output.begin(), output.end(), batchOutput.begin() + f * n));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,51 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/Core/FastWaveKernels.h"
+#include "../WavetableGenerator/Core/WaveKernels.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace Core;
+
+		// Every Fast kernel stays within FastWaveKernels::GetMaxError of the Exact render over the
+		// documented sizes, duties and harmonic counts
+		WTG_TEST(FastWaveKernelsWithinMaxError) {
+			const size_t sizes[] = { 64, 100, 256, 1000, 2048, 8192 };
+			const double duties[] = { 0.1, 0.3, 0.5, 0.7, 0.9 };
+			const int harmonics[] = { 1, 2, 4, 8, 16 };
+			const int numTypes = static_cast<int>(WaveType::Diphthong) + 1;
+
+			for (int t = 0; t < numTypes; ++t) {
+				const WaveType type = static_cast<WaveType>(t);
+				char what[32];
+				std::snprintf(what, sizeof(what), "wave type %d", t);
+
+				WTG_CHECK_KERNEL_ERROR(what, FastWaveKernels::GetMaxError(type), [&](Utils::SimdLevel level) {
+					WaveKernel fast = FastWaveKernels::Get(type, level);
+					float worst = 0.0f;
+					if (!fast) return worst;  // Fast renders this type with the Exact kernel
+
+					for (size_t numSamples : sizes) {
+						for (double duty : duties) {
+							for (int maxHarmonics : harmonics) {
+								WaveKernelParams params;
+								params.numSamples = numSamples;
+								params.pulseDuty = duty;
+								params.maxHarmonics = maxHarmonics;
+
+								std::vector<float> expected(numSamples);
+								WaveKernels::Get(type, GenerationPrecision::Exact)(expected.data(), params);
+								std::vector<float> actual(numSamples);
+								fast(actual.data(), params);
+								worst = (std::max)(worst, MaxDifference(actual, expected));
+							}
+						}
+					}
+					return worst;
+				});
+			}
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/DSP/FrameFilterKernels.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace Core;
+
+		namespace {
+			const FilterType FILTER_TYPES[] = { FilterType::OnePole, FilterType::Biquad, FilterType::StateVariable };
+			const FilterMode FILTER_MODES[] = { FilterMode::LowPass, FilterMode::HighPass };
+
+			// numFrames frames of two sines and a deterministic noise term, within [-2, 2]; every
+			// frame is different so a lane mix-up shows
+			std::vector<float> MakeFrames(size_t numFrames, size_t frameSize) {
+				std::vector<float> frames(numFrames * frameSize);
+				for (size_t i = 0; i < frames.size(); ++i) {
+					float frame = (float)(i / frameSize);
+					float noise = (float)((i * 7919) % 13) / 6.5f - 1.0f;
+					frames[i] = std::sin(0.05f * (float)i) + 0.5f * std::sin(1.3f * (float)i + 0.1f * frame) + 0.2f * noise;
+				}
+				return frames;
+			}
+		}
+
+		// Every compiled kernel stays within GetMaxError of ProcessScalar, for a lone frame (the
+		// scalar fallback), a partial batch and more frames than the widest batch. 100 samples is
+		// not a multiple of the transposition chunk.
+		WTG_TEST(FrameFilterKernelsMatchScalar) {
+			for (FilterType type : FILTER_TYPES) {
+				for (FilterMode mode : FILTER_MODES) {
+					for (float cutoff : { 0.01f, 0.05f, 0.3f, 0.8f, 0.99f }) {
+						for (float resonance : { 0.5f, 0.707f, 3.0f, 10.0f }) {
+							const FrameFilter filter = FrameFilter::Design(type, mode, cutoff, resonance);
+							for (size_t numFrames : { 1, 3, 17 }) {
+								for (size_t frameSize : { 2048, 100 }) {
+									const std::vector<float> input = MakeFrames(numFrames, frameSize);
+									std::vector<float> expected = input;
+									FrameFilterKernels::ProcessScalar(expected.data(), numFrames, frameSize, filter);
+
+									char what[96];
+									std::snprintf(what, sizeof(what), "type %d, mode %d, cutoff %.2f, Q %.3f, %d x %d",
+										(int)type, (int)mode, cutoff, resonance, (int)numFrames, (int)frameSize);
+									WTG_CHECK_KERNEL_ERROR(what, FrameFilterKernels::GetMaxError(type), [&](Utils::SimdLevel level) {
+										std::vector<float> actual = input;
+										FrameFilterKernels::Get(level)(actual.data(), numFrames, frameSize, filter);
+										return MaxDifference(actual, expected, true);
+									});
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
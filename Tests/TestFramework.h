@@ -0,0 +1,73 @@
+#ifndef TESTFRAMEWORK_H
+#define TESTFRAMEWORK_H
+
+#include "../WavetableGenerator/Utils/CpuFeatures.h"
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		// Minimal self-registering test runner (no external framework)
+		// A test is a function defined with WTG_TEST; checks record failures and let the test
+		// carry on. WavetableGeneratorTests runs every test, or the ones named on the command line,
+		// and exits non-zero if any check failed.
+		typedef void (*TestFunction)();
+
+		struct TestEntry {
+			const char* name;
+			TestFunction run;
+		};
+
+		// Every test linked into the executable
+		std::vector<TestEntry>& GetTests();
+
+		// Adds a test to GetTests() during static initialization (see WTG_TEST)
+		struct TestRegistrar {
+			TestRegistrar(const char* name, TestFunction run);
+		};
+
+		// Record a failed check of the running test
+		void ReportFailure(const char* file, int line, const char* message);
+
+		// Check |actual - expected| <= tolerance; false (and a recorded failure) otherwise
+		bool CheckNear(double actual, double expected, double tolerance, const char* file, int line, const char* expression);
+
+		// Instruction sets this CPU can run, Scalar first (kernels are tested at each of them)
+		std::vector<Utils::SimdLevel> GetSupportedSimdLevels();
+
+		// Largest |actual - expected| over the samples, or the difference relative to
+		// max(1, |expected|) if 'relative' is set. NaN counts as an infinite difference.
+		float MaxDifference(const std::vector<float>& actual, const std::vector<float>& expected, bool relative = false);
+
+		// Check a kernel against its reference at every supported instruction set: errorAt(level)
+		// returns the worst difference of the kernel at 'level' over the test's inputs (0 if there
+		// is no kernel at that level), which must stay within maxError.
+		// what: names the kernel in the failure message
+		template <typename ErrorAt>
+		void CheckKernelError(const char* what, double maxError, ErrorAt errorAt, const char* file, int line) {
+			for (Utils::SimdLevel level : GetSupportedSimdLevels()) {
+				char expression[160];
+				std::snprintf(expression, sizeof(expression), "%s at %s", what, Utils::CpuFeatures::GetSimdLevelName(level));
+				CheckNear(errorAt(level), 0.0, maxError, file, line, expression);
+			}
+		}
+	}
+}
+
+#define WTG_TEST(name) \
+	static void name(); \
+	static ::WavetableGen::Tests::TestRegistrar name##Registrar(#name, name); \
+	static void name()
+
+#define WTG_CHECK(condition) \
+	do { \
+		if (!(condition)) ::WavetableGen::Tests::ReportFailure(__FILE__, __LINE__, #condition); \
+	} while (0)
+
+#define WTG_CHECK_NEAR(actual, expected, tolerance) \
+	::WavetableGen::Tests::CheckNear((actual), (expected), (tolerance), __FILE__, __LINE__, #actual " ~ " #expected)
+
+#define WTG_CHECK_KERNEL_ERROR(what, maxError, errorAt) \
+	::WavetableGen::Tests::CheckKernelError((what), (maxError), (errorAt), __FILE__, __LINE__)
+
+#endif // TESTFRAMEWORK_H
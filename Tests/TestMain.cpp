@@ -0,0 +1,93 @@
+#include "TestFramework.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace WavetableGen {
+	namespace Tests {
+		namespace {
+			// Failures of the running test, and how many of them were printed
+			int g_failures = 0;
+			const int MAX_PRINTED_FAILURES = 10;
+		}
+
+		std::vector<TestEntry>& GetTests() {
+			static std::vector<TestEntry> tests;
+			return tests;
+		}
+
+		TestRegistrar::TestRegistrar(const char* name, TestFunction run) {
+			TestEntry entry;
+			entry.name = name;
+			entry.run = run;
+			GetTests().push_back(entry);
+		}
+
+		void ReportFailure(const char* file, int line, const char* message) {
+			if (++g_failures <= MAX_PRINTED_FAILURES)
+				std::printf("  %s(%d): check failed: %s\n", file, line, message);
+		}
+
+		bool CheckNear(double actual, double expected, double tolerance, const char* file, int line, const char* expression) {
+			// Written so that NaN fails
+			if (std::fabs(actual - expected) <= tolerance) return true;
+
+			char message[256];
+			std::snprintf(message, sizeof(message), "%s (%.9g vs %.9g, tolerance %.3g)", expression, actual, expected, tolerance);
+			ReportFailure(file, line, message);
+			return false;
+		}
+
+		std::vector<Utils::SimdLevel> GetSupportedSimdLevels() {
+			const Utils::SimdLevel levels[] = {
+				Utils::SimdLevel::Scalar, Utils::SimdLevel::SSE2, Utils::SimdLevel::AVX2, Utils::SimdLevel::AVX512
+			};
+			std::vector<Utils::SimdLevel> supported;
+			for (Utils::SimdLevel level : levels) {
+				if (level <= Utils::CpuFeatures::GetSimdLevel()) supported.push_back(level);
+			}
+			return supported;
+		}
+
+		float MaxDifference(const std::vector<float>& actual, const std::vector<float>& expected, bool relative) {
+			float worst = 0.0f;
+			for (size_t i = 0; i < expected.size(); ++i) {
+				float difference = std::fabs(actual[i] - expected[i]);
+				if (relative) difference /= (std::max)(1.0f, std::fabs(expected[i]));
+				worst = (std::max)(worst, difference == difference ? difference : INFINITY);
+			}
+			return worst;
+		}
+
+		// Run one test; true if every check passed
+		bool RunTest(const TestEntry& test) {
+			g_failures = 0;
+			test.run();
+			if (g_failures > MAX_PRINTED_FAILURES)
+				std::printf("  ... %d more failures\n", g_failures - MAX_PRINTED_FAILURES);
+			std::printf("[%s] %s\n", g_failures == 0 ? "  OK  " : " FAIL ", test.name);
+			return g_failures == 0;
+		}
+	}
+}
+
+// Usage: WavetableGeneratorTests [name...]
+int main(int argc, char** argv) {
+	using namespace WavetableGen::Tests;
+
+	int run = 0;
+	int failed = 0;
+	for (const TestEntry& test : GetTests()) {
+		bool selected = argc == 1;
+		for (int i = 1; i < argc && !selected; ++i)
+			selected = std::strcmp(argv[i], test.name) == 0;
+		if (!selected) continue;
+
+		++run;
+		if (!RunTest(test)) ++failed;
+	}
+
+	std::printf("%d tests, %d failed\n", run, failed);
+	return run == 0 || failed > 0 ? 1 : 0;
+}
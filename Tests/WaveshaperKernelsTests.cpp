@@ -0,0 +1,117 @@
+#include "TestFramework.h"
+#include "../WavetableGenerator/DSP/WaveshaperKernels.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Tests {
+		using namespace Core;
+
+		namespace {
+			const DistortionType DISTORTION_TYPES[] = {
+				DistortionType::None, DistortionType::Soft, DistortionType::Hard, DistortionType::Asymmetric
+			};
+
+			// A ramp over [-4, 4], the input range GetMaxError is stated for; the odd length
+			// leaves a partial vector at the end for every instruction set
+			std::vector<float> MakeRamp() {
+				const size_t count = 4099;
+				std::vector<float> ramp(count);
+				for (size_t i = 0; i < count; ++i)
+					ramp[i] = -4.0f + 8.0f * (float)i / (float)(count - 1);
+				return ramp;
+			}
+		}
+
+		// Without bit crush every compiled kernel stays within GetMaxError of the scalar reference
+		WTG_TEST(WaveshaperKernelsMatchScalar) {
+			const std::vector<float> input = MakeRamp();
+			for (DistortionType type : DISTORTION_TYPES) {
+				for (int amount = 0; amount <= 20; ++amount) {
+					for (int fold = 0; fold <= 10; fold += 2) {
+						WaveformEffects::NonlinearStage stage;
+						stage.distortionType = type;
+						stage.distortionAmount = (float)amount / 20.0f;
+						stage.wavefoldAmount = (float)fold / 10.0f;
+						const WaveshaperParams params = WaveshaperParams::FromStage(stage);
+
+						std::vector<float> expected = input;
+						WaveshaperKernels::ProcessScalar(expected.data(), expected.size(), params);
+
+						char what[64];
+						std::snprintf(what, sizeof(what), "type %d, amount %.2f, fold %.1f",
+							(int)type, stage.distortionAmount, stage.wavefoldAmount);
+						WTG_CHECK_KERNEL_ERROR(what, WaveshaperKernels::GetMaxError(), [&](Utils::SimdLevel level) {
+							std::vector<float> actual = input;
+							WaveshaperKernels::Get(level)(actual.data(), actual.size(), params);
+							return MaxDifference(actual, expected);
+						});
+					}
+				}
+			}
+		}
+
+		// With bit crush a sample may only land one step away, and only where the shaped value is
+		// within GetMaxError of a step boundary
+		WTG_TEST(WaveshaperKernelsBitCrushWithinOneStep) {
+			const std::vector<float> input = MakeRamp();
+			for (Utils::SimdLevel level : GetSupportedSimdLevels()) {
+				for (DistortionType type : DISTORTION_TYPES) {
+					for (int bits : { 12, 8, 4, 1 }) {
+						WaveformEffects::NonlinearStage stage;
+						stage.distortionType = type;
+						stage.distortionAmount = 0.6f;
+						stage.wavefoldAmount = 0.4f;
+						stage.bitDepth = bits;
+						const WaveshaperParams params = WaveshaperParams::FromStage(stage);
+
+						WaveshaperParams shapeOnly = params;
+						shapeOnly.bitCrush = false;
+						std::vector<float> shaped = input;
+						WaveshaperKernels::ProcessScalar(shaped.data(), shaped.size(), shapeOnly);
+
+						std::vector<float> expected = input;
+						WaveshaperKernels::ProcessScalar(expected.data(), expected.size(), params);
+						std::vector<float> actual = input;
+						WaveshaperKernels::Get(level)(actual.data(), actual.size(), params);
+
+						for (size_t i = 0; i < input.size(); ++i) {
+							if (actual[i] == expected[i]) continue;
+
+							// Distance of the shaped value from the nearest step boundary
+							float scaled = shaped[i] * params.crushStepInv;
+							float boundaryDistance = std::fabs(scaled - std::round(scaled)) * params.crushStep;
+							bool oneStep = std::fabs(std::fabs(actual[i] - expected[i]) - params.crushStep) <= 1e-6f;
+							if (!oneStep || boundaryDistance > WaveshaperKernels::GetMaxError()) {
+								char message[160];
+								std::snprintf(message, sizeof(message), "%s: type %d, %d bits, input %.7g gives %.7g, expected %.7g",
+									Utils::CpuFeatures::GetSimdLevelName(level), (int)type, bits, input[i], actual[i], expected[i]);
+								ReportFailure(__FILE__, __LINE__, message);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Kernels process exactly 'count' samples and leave the rest of the buffer alone
+		WTG_TEST(WaveshaperKernelsStopAtCount) {
+			WaveformEffects::NonlinearStage stage;
+			stage.distortionType = DistortionType::Soft;
+			stage.distortionAmount = 0.5f;
+			stage.wavefoldAmount = 0.5f;
+			stage.bitDepth = 8;
+			const WaveshaperParams params = WaveshaperParams::FromStage(stage);
+
+			for (Utils::SimdLevel level : GetSupportedSimdLevels()) {
+				for (size_t count = 0; count <= 40; ++count) {
+					std::vector<float> buffer(48, 3.0f);
+					WaveshaperKernels::Get(level)(buffer.data(), count, params);
+					for (size_t i = count; i < buffer.size(); ++i)
+						WTG_CHECK(buffer[i] == 3.0f);
+				}
+			}
+		}
+	}
+}
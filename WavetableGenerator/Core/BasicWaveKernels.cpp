@@ -0,0 +1,44 @@
+#include "BasicWaveKernels.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel BasicWaveKernels::Get(WaveType type) {
+			return Get(type, Utils::CpuFeatures::GetSimdLevel());
+		}
+
+		WaveKernel BasicWaveKernels::Get(WaveType type, Utils::SimdLevel level) {
+			WaveKernel kernel = nullptr;
+
+			// Fall back to the next lower instruction set if a level was not compiled in
+			switch (level) {
+			case Utils::SimdLevel::AVX512:
+				kernel = GetAVX512(type);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::AVX2:
+				kernel = GetAVX2(type);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::SSE2:
+				kernel = GetSSE2(type);
+				break;
+			default:
+				break;
+			}
+
+			return kernel;
+		}
+
+		float BasicWaveKernels::GetMaxError(WaveType type) {
+			switch (type) {
+			case WaveType::Sine: return 5e-7f;
+			case WaveType::Supersaw: return 6e-7f;
+			case WaveType::Square: return 2.4e-7f;
+			case WaveType::Pulse: return 2.4e-7f;
+			case WaveType::PWMSaw: return 2.4e-7f;
+			case WaveType::Trapezoid: return 1.7e-6f;
+			default: return 0.0f;
+			}
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef BASICWAVEKERNELS_H
+#define BASICWAVEKERNELS_H
+
+#include "WaveKernels.h"
+#include "../Utils/CpuFeatures.h"
+
+namespace WavetableGen {
+	namespace Core {
+		// Vectorized kernels for the basic and PolyBLEP waveforms
+		// (Sine, Square, Triangle, Saw, ReverseSaw, Pulse, PWMSaw, Trapezoid, Supersaw)
+		// The instruction set is picked at runtime from CpuFeatures; each ISA lives in its own
+		// translation unit compiled with matching /arch flags.
+		//
+		// Accuracy against the scalar kernels (WaveKernels::GetScalar), measured for N = 3..8192:
+		//   Square, Triangle, Saw, ReverseSaw, Pulse, PWMSaw, Trapezoid - bit-exact
+		//     (if the compiler contracts mul+add into FMA, Square, Pulse and PWMSaw stay within
+		//     1.2e-7 and Trapezoid within 8.3e-7 relative)
+		//   Sine, Supersaw - within 3e-7 absolute (polynomial sine instead of double sin())
+		class BasicWaveKernels {
+		public:
+			// Best kernel for the running CPU, or nullptr if the type has no vectorized kernel
+			static WaveKernel Get(WaveType type);
+
+			// Kernel for a specific instruction set, or nullptr if the type has no vectorized kernel
+			// or the instruction set was not compiled into this build
+			static WaveKernel Get(WaveType type, Utils::SimdLevel level);
+
+			// Largest difference of a vectorized render from the scalar render of the same type,
+			// relative to max(1, |scalar sample|): the measured bounds above with a 2x margin, FMA
+			// contraction included. 0 means the kernel renders the type bit-exactly.
+			static float GetMaxError(WaveType type);
+
+			// True if the vectorized kernel matches the scalar kernel bit for bit (usable for Exact)
+			static bool IsExact(WaveType type) { return type != WaveType::Sine && type != WaveType::Supersaw; }
+
+		private:
+			// One entry point per instruction set (see BasicWaveKernelsSSE2/AVX2/AVX512.cpp)
+			static WaveKernel GetSSE2(WaveType type);
+			static WaveKernel GetAVX2(WaveType type);
+			static WaveKernel GetAVX512(WaveType type);
+		};
+	}
+}
+
+#endif // BASICWAVEKERNELS_H
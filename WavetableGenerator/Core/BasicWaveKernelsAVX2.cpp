@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX2 (see WavetableGenerator.vcxproj)
+#include "BasicWaveKernels.h"
+#include "BasicWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel BasicWaveKernels::GetAVX2(WaveType type) {
+#if defined(WTG_HAS_AVX2)
+			return BasicWaveKernelsSimd<Utils::VecAVX2>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX512 (see WavetableGenerator.vcxproj)
+#include "BasicWaveKernels.h"
+#include "BasicWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel BasicWaveKernels::GetAVX512(WaveType type) {
+#if defined(WTG_HAS_AVX512)
+			return BasicWaveKernelsSimd<Utils::VecAVX512>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
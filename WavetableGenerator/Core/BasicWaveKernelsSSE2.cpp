@@ -0,0 +1,16 @@
+// SSE2 is the x64 baseline, so no extra /arch flag is needed
+#include "BasicWaveKernels.h"
+#include "BasicWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel BasicWaveKernels::GetSSE2(WaveType type) {
+#if defined(WTG_HAS_SSE2)
+			return BasicWaveKernelsSimd<Utils::VecSSE2>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,180 @@
+#ifndef BASICWAVEKERNELSSIMD_H
+#define BASICWAVEKERNELSSIMD_H
+
+// Instruction-set independent implementation of the vectorized basic wave kernels.
+// Only include this from the per-ISA translation units (BasicWaveKernelsSSE2/AVX2/AVX512.cpp):
+// it is instantiated once per vector type from Utils/SimdVector.h.
+// Deliberately uses no standard library functions, so nothing with external linkage is
+// emitted with AVX encodings.
+
+#include <cstring>
+#include "WaveKernels.h"
+#include "../Utils/SimdVector.h"
+#include "../Utils/SimdMath.h"
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			template <class V>
+			class BasicWaveKernelsSimd {
+				typedef typename V::Reg Reg;
+				typedef Utils::SimdMath<V> M;
+
+			public:
+				static WaveKernel Get(WaveType type) {
+					switch (type) {
+					case WaveType::Sine: return RenderSine;
+					case WaveType::Square: return RenderSquare;
+					case WaveType::Triangle: return RenderTriangle;
+					case WaveType::Saw: return RenderSaw;
+					case WaveType::ReverseSaw: return RenderReverseSaw;
+					case WaveType::Pulse: return RenderPulse;
+					case WaveType::PWMSaw: return RenderPWMSaw;
+					case WaveType::Trapezoid: return RenderTrapezoid;
+					case WaveType::Supersaw: return RenderSupersaw;
+					default: return nullptr;
+					}
+				}
+
+			private:
+				// Smallest float >= duty, so that (t < threshold) matches the scalar float-vs-double compare
+				static float DutyThreshold(double duty) {
+					float threshold = (float)duty;
+					if ((double)threshold < duty) {
+						unsigned int bits;
+						std::memcpy(&bits, &threshold, sizeof(bits));
+						bits = threshold >= 0.0f ? bits + 1 : bits - 1;
+						std::memcpy(&threshold, &bits, sizeof(bits));
+					}
+					return threshold;
+				}
+
+				// Pulse-style wave with PolyBLEP edges at 0 and at the duty point
+				static void RenderPulseWave(float* output, size_t numSamples, double duty) {
+					const float dtScalar = 1.0f / (float)numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg threshold = V::Set1(DutyThreshold(duty));
+					const Reg dutyPoint = V::Set1((float)duty);
+					const Reg high = V::Set1(1.0f);
+					const Reg low = V::Set1(-1.0f);
+
+					M::Render(output, numSamples, [=](Reg t) {
+						Reg value = V::Select(V::CmpLt(t, threshold), high, low);
+						value = V::Sub(value, M::PolyBLEP(t, dt, oneMinusDt));
+						// (t - duty + 1): subtract first, exactly as the scalar kernel does
+						Reg shifted = V::Add(V::Sub(t, dutyPoint), high);
+						value = V::Add(value, M::PolyBLEP(M::Fmod1(shifted), dt, oneMinusDt));
+						return value;
+					});
+				}
+
+				static void RenderSine(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) { return M::SinTurns(t); });
+				}
+
+				static void RenderSquare(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg half = V::Set1(0.5f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Select(V::CmpLt(t, half), V::Set1(1.0f), V::Set1(-1.0f));
+						value = V::Sub(value, M::PolyBLEP(t, dt, oneMinusDt));
+						value = V::Add(value, M::PolyBLEP(M::Fmod1(V::Add(t, half)), dt, oneMinusDt));
+						return value;
+					});
+				}
+
+				static void RenderTriangle(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg half = V::Set1(0.5f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Sub(V::Set1(1.0f), V::Mul(V::Set1(4.0f), V::Abs(V::Sub(t, half))));
+						value = V::Add(value, V::Mul(dt, M::PolyBLEP(t, dt, oneMinusDt)));
+						value = V::Sub(value, V::Mul(dt, M::PolyBLEP(M::Fmod1(V::Add(t, half)), dt, oneMinusDt)));
+						return value;
+					});
+				}
+
+				static void RenderSaw(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg two = V::Set1(2.0f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Sub(V::Mul(two, t), V::Set1(1.0f));
+						return V::Sub(value, V::Mul(two, M::PolyBLEP(t, dt, oneMinusDt)));
+					});
+				}
+
+				static void RenderReverseSaw(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg two = V::Set1(2.0f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Sub(V::Set1(1.0f), V::Mul(two, t));
+						return V::Add(value, V::Mul(two, M::PolyBLEP(t, dt, oneMinusDt)));
+					});
+				}
+
+				static void RenderPulse(float* output, const WaveKernelParams& p) {
+					RenderPulseWave(output, p.numSamples, p.pulseDuty);
+				}
+
+				static void RenderPWMSaw(float* output, const WaveKernelParams& p) {
+					RenderPulseWave(output, p.numSamples, 0.25);
+				}
+
+				static void RenderTrapezoid(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg slope = V::Set1(0.2f);
+					const Reg half = V::Set1(0.5f);
+					const Reg fall = V::Set1(0.5f + 0.2f);
+					const Reg one = V::Set1(1.0f);
+					const Reg two = V::Set1(2.0f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg rise = V::Sub(V::Mul(V::Div(t, slope), two), one);
+						Reg drop = V::Sub(one, V::Mul(V::Div(V::Sub(t, half), slope), two));
+						Reg value = V::Select(V::CmpLt(t, slope), rise,
+							V::Select(V::CmpLt(t, half), one,
+								V::Select(V::CmpLt(t, fall), drop, V::Set1(-1.0f))));
+
+						value = V::Add(value, V::Mul(dt, M::PolyBLEP(t, dt, oneMinusDt)));
+						value = V::Sub(value, V::Mul(dt, M::PolyBLEP(M::Fmod1(V::Sub(t, slope)), dt, oneMinusDt)));
+						value = V::Sub(value, V::Mul(dt, M::PolyBLEP(M::Fmod1(V::Sub(t, half)), dt, oneMinusDt)));
+						value = V::Add(value, V::Mul(dt, M::PolyBLEP(M::Fmod1(V::Sub(V::Sub(t, half), slope)), dt, oneMinusDt)));
+						return value;
+					});
+				}
+
+				static void RenderSupersaw(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+					const Reg two = V::Set1(2.0f);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Sub(V::Mul(two, t), V::Set1(1.0f));
+						value = V::Sub(value, V::Mul(two, M::PolyBLEP(t, dt, oneMinusDt)));
+						value = V::Add(value, V::Mul(V::Set1(0.2f), M::SinTurns(V::Add(t, t))));
+						value = V::Add(value, V::Mul(V::Set1(0.1f), M::SinTurns(V::Mul(V::Set1(3.0f), t))));
+						return value;
+					});
+				}
+			};
+		}
+	}
+}
+
+#endif // BASICWAVEKERNELSSIMD_H
@@ -0,0 +1,130 @@
+#include "ChaosEngine.h"
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		void ChaosEngine::RenderLorenz(float* output, size_t numSamples) {
+			// Lorenz attractor - project X coordinate
+			float sigma = 10.0f, rho = 28.0f, beta = 8.0f / 3.0f;
+			float x = 0.1f, y = 0.0f, z = 0.0f;
+			float dt_sim = 0.01f;
+
+			// Advance the simulation just far enough to reach each sample's point in the cycle
+			int step = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				int steps = (int)(t * 200.0f);
+				for (; step < steps; ++step) {
+					float dx = sigma * (y - x);
+					float dy = x * (rho - z) - y;
+					float dz = x * y - beta * z;
+					x += dx * dt_sim;
+					y += dy * dt_sim;
+					z += dz * dt_sim;
+				}
+				output[n] = std::tanh(x / 15.0f); // Normalize
+			}
+		}
+
+		void ChaosEngine::RenderRossler(float* output, size_t numSamples) {
+			// Rössler attractor - project X coordinate
+			float a = 0.2f, b = 0.2f, c = 5.7f;
+			float x = 0.1f, y = 0.0f, z = 0.0f;
+			float dt_sim = 0.05f;
+
+			int step = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				int steps = (int)(t * 100.0f);
+				for (; step < steps; ++step) {
+					float dx = -y - z;
+					float dy = x + a * y;
+					float dz = b + z * (x - c);
+					x += dx * dt_sim;
+					y += dy * dt_sim;
+					z += dz * dt_sim;
+				}
+				output[n] = std::tanh(x / 5.0f);
+			}
+		}
+
+		void ChaosEngine::RenderHenon(float* output, size_t numSamples) {
+			// Hénon map
+			float a = 1.4f, b = 0.3f;
+			float x = 0.1f, y = 0.1f;
+
+			int iteration = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				int iterations = (int)(t * 50.0f);
+				for (; iteration < iterations; ++iteration) {
+					float xnew = 1.0f - a * x * x + y;
+					y = b * x;
+					x = xnew;
+				}
+				output[n] = std::tanh(x);
+			}
+		}
+
+		void ChaosEngine::RenderDuffing(float* output, size_t numSamples) {
+			// Duffing oscillator - forced nonlinear oscillator
+			float alpha = -1.0f, beta = 1.0f, delta = 0.3f, gamma = 0.37f, omega = 1.2f;
+			float x = 0.1f, v = 0.0f;
+			float dt_sim = 0.05f;
+
+			// Simulation time is accumulated exactly as a fresh integration would, so each
+			// sample sees the same state it would have reached starting from t_sim = 0
+			float t_sim = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				float time = (float)t * 10.0f;
+				for (; t_sim < time; t_sim += dt_sim) {
+					float force = gamma * (float)cos(omega * t_sim);
+					float dv = -delta * v - alpha * x - beta * x * x * x + force;
+					v += dv * dt_sim;
+					x += v * dt_sim;
+				}
+				output[n] = std::tanh(x);
+			}
+		}
+
+		void ChaosEngine::RenderChua(float* output, size_t numSamples) {
+			// Chua's circuit - simplified version
+			float alpha = 15.6f, beta = 28.0f;
+			float x = 0.1f, y = 0.0f, z = 0.0f;
+			float dt_sim = 0.01f;
+
+			int step = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				int steps = (int)(t * 150.0f);
+				for (; step < steps; ++step) {
+					float h = -1.143f * x + 0.714f * (std::abs(x + 1.0f) - std::abs(x - 1.0f));
+					float dx = alpha * (y - x - h);
+					float dy = x - y + z;
+					float dz = -beta * y;
+					x += dx * dt_sim;
+					y += dy * dt_sim;
+					z += dz * dt_sim;
+				}
+				output[n] = std::tanh(x / 2.0f);
+			}
+		}
+
+		void ChaosEngine::RenderLogisticChaos(float* output, size_t numSamples) {
+			// Logistic map in chaotic regime (r = 3.9)
+			float r = 3.9f;
+			float x = 0.5f;
+
+			int iteration = 0;
+			for (size_t n = 0; n < numSamples; ++n) {
+				double t = (double)n / numSamples;
+				int iterations = (int)(t * 100.0f) + 50; // Skip transient
+				for (; iteration < iterations; ++iteration) {
+					x = r * x * (1.0f - x);
+				}
+				output[n] = (x - 0.5f) * 2.0f;
+			}
+		}
+	}
+}
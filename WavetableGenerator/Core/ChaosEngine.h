@@ -0,0 +1,25 @@
+#ifndef CHAOSENGINE_H
+#define CHAOSENGINE_H
+
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Core {
+		// Chaos waveform engine (Single Responsibility Principle)
+		// Each attractor/map is integrated exactly once across the cycle: the integrator state only
+		// moves forward, so sample n reuses the state reached for sample n-1 instead of restarting
+		// from the initial conditions. One cycle is a single O(N) pass with the same output shape.
+		class ChaosEngine {
+		public:
+			// Render one cycle of a chaos waveform into output (numSamples values, DC not removed)
+			static void RenderLorenz(float* output, size_t numSamples);
+			static void RenderRossler(float* output, size_t numSamples);
+			static void RenderHenon(float* output, size_t numSamples);
+			static void RenderDuffing(float* output, size_t numSamples);
+			static void RenderChua(float* output, size_t numSamples);
+			static void RenderLogisticChaos(float* output, size_t numSamples);
+		};
+	}
+}
+
+#endif // CHAOSENGINE_H
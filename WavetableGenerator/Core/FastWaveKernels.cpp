@@ -0,0 +1,82 @@
+#include "FastWaveKernels.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel FastWaveKernels::Get(WaveType type) {
+			return Get(type, Utils::CpuFeatures::GetSimdLevel());
+		}
+
+		WaveKernel FastWaveKernels::Get(WaveType type, Utils::SimdLevel level) {
+			WaveKernel kernel = nullptr;
+
+			// Fall back to the next lower instruction set if a level was not compiled in
+			switch (level) {
+			case Utils::SimdLevel::AVX512:
+				kernel = GetAVX512(type);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::AVX2:
+				kernel = GetAVX2(type);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::SSE2:
+				kernel = GetSSE2(type);
+				break;
+			default:
+				break;
+			}
+
+			return kernel;
+		}
+
+		float FastWaveKernels::GetMaxError(WaveType type) {
+			switch (type) {
+			case WaveType::Sine: return 4e-7f;
+			case WaveType::SubHarmonics: return 6e-7f;
+			case WaveType::Formant: return 3e-6f;
+			case WaveType::StretchedHarm: return 8e-6f;
+			case WaveType::CompressedHarm: return 3e-6f;
+			case WaveType::Metallic: return 2e-6f;
+			case WaveType::Clangorous: return 6e-7f;
+			case WaveType::StiffString: return 6e-6f;
+			case WaveType::Supersaw: return 4e-7f;
+			case WaveType::DoubleSine: return 2e-6f;
+			case WaveType::HalfSine: return 8e-7f;
+			case WaveType::Power: return 3e-7f;
+			case WaveType::Exponential: return 2e-6f;
+			case WaveType::Logistic: return 5e-7f;
+			case WaveType::Procedural: return 2e-6f;
+			case WaveType::Sinc: return 3e-7f;
+			case WaveType::RingMod: return 3e-6f;
+			case WaveType::AmplitudeMod: return 5e-7f;
+			case WaveType::FrequencyMod: return 5e-6f;
+			case WaveType::CrossMod: return 9e-7f;
+			case WaveType::PhaseMod: return 4e-6f;
+			case WaveType::Reed: return 2e-6f;
+			case WaveType::Vocal: return 3e-6f;
+			case WaveType::Bell: return 2e-6f;
+			case WaveType::SimpleFM: return 2e-6f;
+			case WaveType::ComplexFM: return 2e-6f;
+			case WaveType::PhaseDistortion: return 8e-7f;
+			case WaveType::Wavefold: return 5e-7f;
+			case WaveType::HardSync: return 8e-7f;
+			case WaveType::Chebyshev: return 2e-6f;
+			case WaveType::ARPOdyssey: return 4e-7f;
+			case WaveType::CS80: return 3e-7f;
+			case WaveType::Juno: return 3e-7f;
+			case WaveType::MS20: return 2e-6f;
+			case WaveType::PPG: return 2e-7f;
+			case WaveType::Prophet5: return 3e-7f;
+			case WaveType::TB303: return 6e-7f;
+			case WaveType::VowelA: return 4e-6f;
+			case WaveType::VowelE: return 3e-6f;
+			case WaveType::VowelI: return 4e-6f;
+			case WaveType::VowelO: return 3e-6f;
+			case WaveType::VowelU: return 2e-6f;
+			case WaveType::Diphthong: return 2e-5f;
+			default:
+				return 0.0f;
+			}
+		}
+	}
+}
@@ -0,0 +1,36 @@
+#ifndef FASTWAVEKERNELS_H
+#define FASTWAVEKERNELS_H
+
+#include "WaveKernels.h"
+#include "../Utils/CpuFeatures.h"
+
+namespace WavetableGen {
+	namespace Core {
+		// Vectorized float32 kernels for GenerationPrecision::Fast
+		// Phase is a float32 and sin/exp/tanh are polynomial approximations (Utils/SimdMath.h),
+		// so these trade a small, documented error for speed. Types without a Fast kernel (chaos,
+		// fractals, FFT-rendered harmonic series, pure arithmetic shapes) render exactly as in Exact.
+		// The instruction set is picked at runtime like BasicWaveKernels.
+		class FastWaveKernels {
+		public:
+			// Best Fast kernel for the running CPU, or nullptr if the type has none
+			static WaveKernel Get(WaveType type);
+
+			// Fast kernel for a specific instruction set, or nullptr
+			static WaveKernel Get(WaveType type, Utils::SimdLevel level);
+
+			// Largest absolute difference of a Fast render from the Exact render of the same type
+			// (before DC removal and normalization), measured for N = 64..8192, duty 0.1..0.9 and
+			// 1..16 harmonics with a 2x margin. 0 means Fast renders the type bit-exactly.
+			static float GetMaxError(WaveType type);
+
+		private:
+			// One entry point per instruction set (see FastWaveKernelsSSE2/AVX2/AVX512.cpp)
+			static WaveKernel GetSSE2(WaveType type);
+			static WaveKernel GetAVX2(WaveType type);
+			static WaveKernel GetAVX512(WaveType type);
+		};
+	}
+}
+
+#endif // FASTWAVEKERNELS_H
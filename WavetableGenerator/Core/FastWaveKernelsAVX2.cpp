@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX2 (see WavetableGenerator.vcxproj)
+#include "FastWaveKernels.h"
+#include "FastWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel FastWaveKernels::GetAVX2(WaveType type) {
+#if defined(WTG_HAS_AVX2)
+			return FastWaveKernelsSimd<Utils::VecAVX2>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
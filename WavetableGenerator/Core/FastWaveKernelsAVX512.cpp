@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX512 (see WavetableGenerator.vcxproj)
+#include "FastWaveKernels.h"
+#include "FastWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel FastWaveKernels::GetAVX512(WaveType type) {
+#if defined(WTG_HAS_AVX512)
+			return FastWaveKernelsSimd<Utils::VecAVX512>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,16 @@
+// SSE2 is the x64 baseline, so no extra /arch flag is needed
+#include "FastWaveKernels.h"
+#include "FastWaveKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveKernel FastWaveKernels::GetSSE2(WaveType type) {
+#if defined(WTG_HAS_SSE2)
+			return FastWaveKernelsSimd<Utils::VecSSE2>::Get(type);
+#else
+			(void)type;
+			return nullptr;
+#endif
+		}
+	}
+}
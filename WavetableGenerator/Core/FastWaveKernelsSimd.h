@@ -0,0 +1,487 @@
+#ifndef FASTWAVEKERNELSSIMD_H
+#define FASTWAVEKERNELSSIMD_H
+
+// Instruction-set independent implementation of the GenerationPrecision::Fast kernels.
+// Only include this from the per-ISA translation units (FastWaveKernelsSSE2/AVX2/AVX512.cpp):
+// it is instantiated once per vector type from Utils/SimdVector.h.
+// Like BasicWaveKernelsSimd.h it uses no inline standard library functions.
+//
+// Each kernel is the float32 counterpart of the scalar kernel of the same name in
+// WaveKernels.cpp: the phase t = n / numSamples is a float, and sin/exp/tanh are the
+// polynomial approximations from Utils/SimdMath.h instead of double library calls.
+
+#include "WaveKernels.h"
+#include "../Utils/SimdVector.h"
+#include "../Utils/SimdMath.h"
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			template <class V>
+			class FastWaveKernelsSimd {
+				typedef typename V::Reg Reg;
+				typedef Utils::SimdMath<V> M;
+
+			public:
+				static WaveKernel Get(WaveType type) {
+					switch (type) {
+					// Harmonic / inharmonic series
+					case WaveType::SubHarmonics: return RenderSubHarmonics;
+					case WaveType::Formant: return RenderFormant;
+					case WaveType::StretchedHarm: return RenderStretchedHarm;
+					case WaveType::CompressedHarm: return RenderCompressedHarm;
+					case WaveType::Metallic: return RenderMetallic;
+					case WaveType::Clangorous: return RenderClangorous;
+					case WaveType::StiffString: return RenderStiffString;
+					// Modern/Digital + Mathematical
+					case WaveType::DoubleSine: return RenderDoubleSine;
+					case WaveType::HalfSine: return RenderHalfSine;
+					case WaveType::Power: return RenderPower;
+					case WaveType::Exponential: return RenderExponential;
+					case WaveType::Logistic: return RenderLogistic;
+					case WaveType::Procedural: return RenderProcedural;
+					case WaveType::Sinc: return RenderSinc;
+					// Modulation synthesis
+					case WaveType::RingMod: return RenderRingMod;
+					case WaveType::AmplitudeMod: return RenderAmplitudeMod;
+					case WaveType::FrequencyMod: return RenderFrequencyMod;
+					case WaveType::CrossMod: return RenderCrossMod;
+					case WaveType::PhaseMod: return RenderPhaseMod;
+					// Physical models
+					case WaveType::Reed: return RenderReed;
+					case WaveType::Vocal: return RenderVocal;
+					case WaveType::Bell: return RenderBell;
+					// Synthesis waves
+					case WaveType::SimpleFM: return RenderSimpleFM;
+					case WaveType::ComplexFM: return RenderComplexFM;
+					case WaveType::PhaseDistortion: return RenderPhaseDistortion;
+					case WaveType::Wavefold: return RenderWavefold;
+					case WaveType::HardSync: return RenderHardSync;
+					case WaveType::Chebyshev: return RenderChebyshev;
+					// Vintage synth emulations
+					case WaveType::ARPOdyssey: return RenderARPOdyssey;
+					case WaveType::CS80: return RenderCS80;
+					case WaveType::Juno: return RenderJuno;
+					case WaveType::MS20: return RenderMS20;
+					case WaveType::PPG: return RenderPPG;
+					case WaveType::Prophet5: return RenderProphet5;
+					case WaveType::TB303: return RenderTB303;
+					// Vowel formants
+					case WaveType::VowelA: return RenderVowelA;
+					case WaveType::VowelE: return RenderVowelE;
+					case WaveType::VowelI: return RenderVowelI;
+					case WaveType::VowelO: return RenderVowelO;
+					case WaveType::VowelU: return RenderVowelU;
+					case WaveType::Diphthong: return RenderDiphthong;
+					default: return nullptr;
+					}
+				}
+
+			private:
+				// sin(2*PI*ratio*t)
+				static Reg Sin(Reg t, float ratio) {
+					return M::SinTurns(V::Mul(V::Set1(ratio), t));
+				}
+
+				// Saw with a PolyBLEP step at t = 0 (shared by the vintage emulations)
+				static Reg BlepSaw(Reg t, Reg dt, Reg oneMinusDt) {
+					Reg saw = V::Sub(V::Add(t, t), V::Set1(1.0f));
+					return V::Sub(saw, V::Mul(V::Set1(2.0f), M::PolyBLEP(t, dt, oneMinusDt)));
+				}
+
+				// Largest partial count rendered here; larger counts use the exact kernel
+				static const int MAX_PARTIALS = 64;
+
+				// Sum of sin(2*PI*ratio_k*t) / k over the partials of an inharmonic series type
+				static void RenderInharmonicSeries(float* output, const WaveKernelParams& p, WaveType type) {
+					if (p.maxHarmonics > MAX_PARTIALS) {
+						WaveKernels::GetScalar(type)(output, p);
+						return;
+					}
+
+					for (size_t n = 0; n < p.numSamples; ++n)
+						output[n] = 0.0f;
+					for (int k = 1; k <= p.maxHarmonics; ++k) {
+						const Reg ratio = V::Set1(WaveKernels::PartialRatio(type, k));
+						const Reg gain = V::Set1(1.0f / (float)k);
+						M::RenderAdd(output, p.numSamples, [=](Reg t) {
+							return V::Mul(M::SinTurns(V::Mul(ratio, t)), gain);
+						});
+					}
+				}
+
+				// ===== HARMONIC / INHARMONIC SERIES =====
+
+				static void RenderSubHarmonics(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg val = M::SinTurns(t);
+						val = V::Add(val, V::Mul(V::Set1(0.5f), M::SinTurns(V::Add(t, V::Set1(0.25f)))));
+						return V::Add(val, V::Mul(V::Set1(0.25f), M::SinTurns(V::Add(t, V::Set1(0.5f)))));
+					});
+				}
+
+				static void RenderFormant(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Add(Sin(t, 2.0f), V::Mul(Sin(t, 3.0f), V::Set1(0.7f)));
+					});
+				}
+
+				static void RenderStretchedHarm(float* output, const WaveKernelParams& p) {
+					RenderInharmonicSeries(output, p, WaveType::StretchedHarm);
+				}
+
+				static void RenderCompressedHarm(float* output, const WaveKernelParams& p) {
+					RenderInharmonicSeries(output, p, WaveType::CompressedHarm);
+				}
+
+				static void RenderStiffString(float* output, const WaveKernelParams& p) {
+					RenderInharmonicSeries(output, p, WaveType::StiffString);
+				}
+
+				static void RenderMetallic(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg val = M::SinTurns(t);
+						val = V::Add(val, V::Mul(V::Set1(0.5f), Sin(t, 2.76f)));
+						val = V::Add(val, V::Mul(V::Set1(0.3f), Sin(t, 5.40f)));
+						val = V::Add(val, V::Mul(V::Set1(0.2f), Sin(t, 8.93f)));
+						return V::Div(val, V::Set1(2.0f));
+					});
+				}
+
+				static void RenderClangorous(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg val = M::SinTurns(t);
+						val = V::Add(val, V::Mul(V::Set1(0.6f), Sin(t, 1.593f)));
+						val = V::Add(val, V::Mul(V::Set1(0.4f), Sin(t, 2.136f)));
+						val = V::Add(val, V::Mul(V::Set1(0.3f), Sin(t, 2.653f)));
+						val = V::Add(val, V::Mul(V::Set1(0.2f), Sin(t, 3.593f)));
+						return V::Div(val, V::Set1(2.5f));
+					});
+				}
+
+				// ===== MODERN/DIGITAL + MATHEMATICAL =====
+
+				static void RenderDoubleSine(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Mul(M::SinTurns(t), M::SinTurns(V::Add(t, V::Set1(0.25f))));
+					});
+				}
+
+				static void RenderHalfSine(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Sub(V::Mul(V::Abs(M::SinTurns(t)), V::Set1(2.0f)), V::Set1(1.0f));
+					});
+				}
+
+				// Rising half for phase < 1, mirrored falling half for phase >= 1 (phase = 2t)
+				template <class Fn>
+				static void RenderMirrored(float* output, size_t numSamples, Fn shape) {
+					M::Render(output, numSamples, [=](Reg t) {
+						const Reg one = V::Set1(1.0f);
+						Reg phase = V::Add(t, t);
+						auto rising = V::CmpLt(phase, one);
+						Reg x = V::Select(rising, phase, V::Sub(phase, one));
+						Reg value = shape(x);
+						return V::Select(rising, value, V::Sub(V::Set1(0.0f), value));
+					});
+				}
+
+				static void RenderPower(float* output, const WaveKernelParams& p) {
+					RenderMirrored(output, p.numSamples, [](Reg x) {
+						// x^1.5 = x * sqrt(x)
+						return V::Sub(V::Mul(V::Mul(x, V::Sqrt(x)), V::Set1(2.0f)), V::Set1(1.0f));
+					});
+				}
+
+				static void RenderExponential(float* output, const WaveKernelParams& p) {
+					const float range = 2.71828182845904524f - 1.0f;
+					RenderMirrored(output, p.numSamples, [=](Reg x) {
+						Reg e = V::Sub(M::Exp(x), V::Set1(1.0f));
+						return V::Sub(V::Div(V::Mul(V::Set1(2.0f), e), V::Set1(range)), V::Set1(1.0f));
+					});
+				}
+
+				static void RenderLogistic(float* output, const WaveKernelParams& p) {
+					RenderMirrored(output, p.numSamples, [](Reg x) {
+						Reg z = V::Sub(V::Mul(x, V::Set1(12.0f)), V::Set1(6.0f));
+						Reg logistic = V::Div(V::Set1(1.0f), V::Add(V::Set1(1.0f), M::Exp(V::Sub(V::Set1(0.0f), z))));
+						return V::Mul(V::Sub(logistic, V::Set1(0.5f)), V::Set1(2.0f));
+					});
+				}
+
+				static void RenderProcedural(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return M::Tanh(V::Mul(V::Set1(3.0f), M::SinTurns(t)));
+					});
+				}
+
+				static void RenderSinc(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						// x = (t - 0.5) * 16 * PI, i.e. (t - 0.5) * 8 turns
+						Reg turns = V::Mul(V::Sub(t, V::Set1(0.5f)), V::Set1(8.0f));
+						Reg x = V::Mul(turns, V::Set1(6.28318530717958647692f));
+						Reg sinc = V::Div(M::SinTurns(turns), x);
+						return V::Select(V::CmpLt(V::Abs(x), V::Set1(0.001f)), V::Set1(1.0f), sinc);
+					});
+				}
+
+				// ===== MODULATION SYNTHESIS =====
+
+				static void RenderRingMod(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Mul(M::SinTurns(t), Sin(t, 3.7f));
+					});
+				}
+
+				static void RenderAmplitudeMod(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg modulator = V::Add(V::Set1(0.5f), V::Mul(V::Set1(0.5f), Sin(t, 0.3f)));
+						return V::Mul(M::SinTurns(t), modulator);
+					});
+				}
+
+				// sin(2*PI*t + index * sin(2*PI*ratio*t)), with the modulator converted to turns
+				static Reg PhaseModulated(Reg t, float index, float ratio) {
+					Reg modulatorTurns = V::Mul(V::Set1(index / 6.28318530717958647692f), Sin(t, ratio));
+					return M::SinTurns(V::Add(t, modulatorTurns));
+				}
+
+				static void RenderFrequencyMod(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) { return PhaseModulated(t, 2.0f, 2.5f); });
+				}
+
+				static void RenderCrossMod(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						const Reg toTurns = V::Set1(0.5f / 6.28318530717958647692f);
+						Reg t2 = V::Mul(V::Set1(1.5f), t);
+						Reg result1 = M::SinTurns(V::Add(t, V::Mul(M::SinTurns(t2), toTurns)));
+						Reg result2 = M::SinTurns(V::Add(t2, V::Mul(M::SinTurns(t), toTurns)));
+						return V::Mul(V::Add(result1, result2), V::Set1(0.5f));
+					});
+				}
+
+				static void RenderPhaseMod(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) { return PhaseModulated(t, 1.5f, 3.0f); });
+				}
+
+				// ===== PHYSICAL MODELS =====
+
+				static void RenderReed(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Add(M::SinTurns(t), V::Mul(V::Set1(0.3f), Sin(t, 3.0f)));
+					});
+				}
+
+				static void RenderVocal(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						return V::Add(Sin(t, 2.0f), V::Mul(Sin(t, 3.0f), V::Set1(0.6f)));
+					});
+				}
+
+				static void RenderBell(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg val = M::SinTurns(t);
+						val = V::Add(val, V::Mul(V::Set1(0.5f), Sin(t, 2.0f)));
+						return V::Add(val, V::Mul(V::Set1(0.35f), Sin(t, 3.0f)));
+					});
+				}
+
+				// ===== SYNTHESIS WAVES =====
+
+				static void RenderSimpleFM(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) { return PhaseModulated(t, 0.3f, 2.0f); });
+				}
+
+				static void RenderComplexFM(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						const float toTurns = 1.0f / 6.28318530717958647692f;
+						Reg mod1 = V::Mul(V::Set1(0.2f * toTurns), Sin(t, 2.0f));
+						Reg mod2 = V::Mul(V::Set1(0.15f * toTurns), Sin(t, 3.0f));
+						return M::SinTurns(V::Add(V::Add(t, mod1), mod2));
+					});
+				}
+
+				static void RenderPhaseDistortion(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg phase = V::Add(t, V::Mul(V::Set1(0.08f), M::SinTurns(t)));
+						return M::SinTurns(phase);
+					});
+				}
+
+				static void RenderWavefold(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						const Reg one = V::Set1(1.0f);
+						const Reg minusOne = V::Set1(-1.0f);
+						Reg x = V::Mul(M::SinTurns(t), V::Set1(1.3f));
+						x = V::Select(V::CmpGt(x, one), V::Sub(V::Set1(2.0f), x), x);
+						x = V::Select(V::CmpLt(x, minusOne), V::Sub(V::Set1(-2.0f), x), x);
+						return x;
+					});
+				}
+
+				static void RenderHardSync(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = BlepSaw(t, dt, oneMinusDt);
+						value = V::Add(value, V::Mul(V::Set1(0.4f), Sin(t, 2.0f)));
+						return V::Add(value, V::Mul(V::Set1(0.2f), Sin(t, 3.0f)));
+					});
+				}
+
+				static void RenderChebyshev(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						Reg x = M::SinTurns(t);
+						Reg x3 = V::Mul(V::Mul(x, x), x);
+						return V::Sub(V::Mul(V::Set1(4.0f), x3), V::Mul(V::Set1(3.0f), x));
+					});
+				}
+
+				// ===== VINTAGE SYNTH EMULATIONS =====
+
+				static void RenderARPOdyssey(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg saw = V::Sub(V::Add(t, t), V::Set1(1.0f));
+						Reg tri = V::Sub(V::Set1(1.0f), V::Mul(V::Set1(4.0f), V::Abs(V::Sub(t, V::Set1(0.5f)))));
+						Reg blend = V::Add(V::Mul(saw, V::Set1(0.7f)), V::Mul(tri, V::Set1(0.3f)));
+						blend = V::Add(blend, V::Mul(V::Set1(0.15f), Sin(t, 3.0f)));
+						return V::Sub(blend, V::Mul(V::Set1(2.0f), M::PolyBLEP(t, dt, oneMinusDt)));
+					});
+				}
+
+				// 2 * frac(t * ratio) - 1
+				static Reg DetunedSaw(Reg t, Reg ratio) {
+					return V::Sub(V::Mul(V::Set1(2.0f), M::Fmod1(V::Mul(t, ratio))), V::Set1(1.0f));
+				}
+
+				static void RenderCS80(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg saw1 = V::Sub(V::Add(t, t), V::Set1(1.0f));
+						Reg saw2 = DetunedSaw(t, V::Set1(1.003f));
+						Reg saw3 = DetunedSaw(t, V::Set1(0.997f));
+						Reg saw4 = DetunedSaw(t, V::Set1(1.001f));
+						Reg lfo = V::Mul(Sin(t, 0.3f), V::Set1(0.002f));
+						Reg blend = V::Add(V::Add(saw1, saw2), V::Add(saw3, V::Mul(saw4, V::Add(V::Set1(1.0f), lfo))));
+						blend = V::Div(blend, V::Set1(4.0f));
+						blend = V::Add(V::Mul(blend, V::Set1(0.85f)), V::Mul(V::Set1(0.15f), M::SinTurns(t)));
+						return V::Sub(blend, V::Mul(V::Set1(2.0f), M::PolyBLEP(t, dt, oneMinusDt)));
+					});
+				}
+
+				static void RenderJuno(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg saw1 = V::Sub(V::Add(t, t), V::Set1(1.0f));
+						Reg saw2 = DetunedSaw(t, V::Set1(1.005f));
+						Reg lfo = V::Mul(Sin(t, 0.5f), V::Set1(0.003f));
+						Reg chorus = DetunedSaw(t, V::Add(V::Set1(1.0f), lfo));
+						Reg blend = V::Add(V::Add(V::Mul(saw1, V::Set1(0.5f)), V::Mul(saw2, V::Set1(0.3f))), V::Mul(chorus, V::Set1(0.2f)));
+						return V::Sub(blend, V::Mul(V::Set1(2.0f), M::PolyBLEP(t, dt, oneMinusDt)));
+					});
+				}
+
+				static void RenderMS20(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Add(BlepSaw(t, dt, oneMinusDt), V::Mul(V::Set1(0.4f), Sin(t, 5.0f)));
+						return M::Tanh(V::Mul(value, V::Set1(1.5f)));
+					});
+				}
+
+				static void RenderPPG(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						const Reg steps = V::Set1(64.0f);
+						Reg phase = V::Div(V::Trunc(V::Mul(t, steps)), steps);
+						Reg ramp = V::Sub(V::Mul(V::Set1(2.0f), phase), V::Set1(1.0f));
+						return V::Add(V::Mul(M::SinTurns(phase), V::Set1(0.7f)), V::Mul(ramp, V::Set1(0.3f)));
+					});
+				}
+
+				static void RenderProphet5(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Mul(BlepSaw(t, dt, oneMinusDt), V::Set1(0.8f));
+						return V::Add(value, V::Mul(V::Set1(0.2f), Sin(t, 2.0f)));
+					});
+				}
+
+				static void RenderTB303(float* output, const WaveKernelParams& p) {
+					const float dtScalar = 1.0f / (float)p.numSamples;
+					const Reg dt = V::Set1(dtScalar);
+					const Reg oneMinusDt = V::Set1(1.0f - dtScalar);
+
+					M::Render(output, p.numSamples, [=](Reg t) {
+						Reg value = V::Add(BlepSaw(t, dt, oneMinusDt), V::Mul(V::Set1(0.3f), Sin(t, 4.0f)));
+						return M::Tanh(V::Mul(value, V::Set1(1.2f)));
+					});
+				}
+
+				// ===== VOWEL FORMANTS =====
+
+				// Three fixed formants relative to middle C (261.63 Hz)
+				static void RenderVowel(float* output, size_t numSamples, float f1Hz, float f2Hz, float f3Hz,
+					float a2, float a3, float scale) {
+					const float r1 = f1Hz / 261.63f, r2 = f2Hz / 261.63f, r3 = f3Hz / 261.63f;
+					M::Render(output, numSamples, [=](Reg t) {
+						Reg sum = V::Add(Sin(t, r1), V::Mul(Sin(t, r2), V::Set1(a2)));
+						sum = V::Add(sum, V::Mul(Sin(t, r3), V::Set1(a3)));
+						return V::Div(sum, V::Set1(scale));
+					});
+				}
+
+				static void RenderVowelA(float* output, const WaveKernelParams& p) {
+					RenderVowel(output, p.numSamples, 730.0f, 1090.0f, 2440.0f, 0.7f, 0.3f, 2.0f);
+				}
+
+				static void RenderVowelE(float* output, const WaveKernelParams& p) {
+					RenderVowel(output, p.numSamples, 530.0f, 1840.0f, 2480.0f, 0.8f, 0.3f, 2.1f);
+				}
+
+				static void RenderVowelI(float* output, const WaveKernelParams& p) {
+					RenderVowel(output, p.numSamples, 270.0f, 2290.0f, 3010.0f, 0.9f, 0.4f, 2.3f);
+				}
+
+				static void RenderVowelO(float* output, const WaveKernelParams& p) {
+					RenderVowel(output, p.numSamples, 570.0f, 840.0f, 2410.0f, 0.7f, 0.2f, 1.9f);
+				}
+
+				static void RenderVowelU(float* output, const WaveKernelParams& p) {
+					RenderVowel(output, p.numSamples, 300.0f, 870.0f, 2240.0f, 0.6f, 0.2f, 1.8f);
+				}
+
+				static void RenderDiphthong(float* output, const WaveKernelParams& p) {
+					M::Render(output, p.numSamples, [](Reg t) {
+						const float toRatio = 1.0f / 261.63f;
+						Reg morph = V::Add(V::Mul(Sin(t, 0.25f), V::Set1(0.5f)), V::Set1(0.5f));
+						Reg f1 = V::Add(V::Set1(730.0f), V::Mul(V::Set1(270.0f - 730.0f), morph));
+						Reg f2 = V::Add(V::Set1(1090.0f), V::Mul(V::Set1(2290.0f - 1090.0f), morph));
+						Reg formant1 = M::SinTurns(V::Mul(V::Mul(f1, V::Set1(toRatio)), t));
+						Reg formant2 = V::Mul(M::SinTurns(V::Mul(V::Mul(f2, V::Set1(toRatio)), t)), V::Set1(0.8f));
+						return V::Div(V::Add(formant1, formant2), V::Set1(1.8f));
+					});
+				}
+			};
+		}
+	}
+}
+
+#endif // FASTWAVEKERNELSSIMD_H
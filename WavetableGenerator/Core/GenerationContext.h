@@ -0,0 +1,51 @@
+#ifndef GENERATIONCONTEXT_H
+#define GENERATIONCONTEXT_H
+
+#include <cstdint>
+#include "WaveType.h"
+
+namespace WavetableGen {
+	namespace Core {
+		// Accuracy/speed trade-off for rendering waveforms
+		enum class GenerationPrecision {
+			Exact,  // Reference kernels: double phase and library sin/exp/tanh
+			Fast    // Float32 phase, polynomial approximations and SIMD (see FastWaveKernels::GetMaxError)
+		};
+
+		// Seed used when the caller does not supply one (fixed, so output is reproducible by default)
+		constexpr uint64_t DEFAULT_GENERATION_SEED = 0x5741564554424C45ull;
+
+		// Per-call generation state (passed down explicitly instead of kept in members or statics)
+		// Everything random is drawn from seeds derived from 'seed', so the same settings and seed
+		// produce bit-identical output on any thread and any number of generator instances.
+		struct GenerationContext {
+			double pulseDuty = 0.5;
+			int maxHarmonics = 8;
+			uint64_t seed = DEFAULT_GENERATION_SEED;
+			GenerationPrecision precision = GenerationPrecision::Exact;
+
+			// Independent seed for one sub-stream (never 0, which XorShift128Plus treats as "use the clock")
+			uint64_t DeriveSeed(uint64_t stream) const {
+				// splitmix64 of the seed/stream pair
+				uint64_t x = seed ^ (stream * 0x9e3779b97f4a7c15ull);
+				x += 0x9e3779b97f4a7c15ull;
+				x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+				x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+				x ^= x >> 31;
+				return x != 0 ? x : 1;
+			}
+
+			// Seed for the effects applied to one frame
+			uint64_t FrameSeed(int frame) const {
+				return DeriveSeed((uint64_t)(uint32_t)frame);
+			}
+
+			// Seed for rendering a randomized basis wave
+			uint64_t WaveSeed(WaveType type) const {
+				return DeriveSeed(0x100000000ull + (uint64_t)type);
+			}
+		};
+	}
+}
+
+#endif // GENERATIONCONTEXT_H
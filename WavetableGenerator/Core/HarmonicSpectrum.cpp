@@ -0,0 +1,56 @@
+#include "HarmonicSpectrum.h"
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		bool HarmonicSpectrum::Supports(size_t numSamples) {
+			return numSamples >= 2 && (numSamples & (numSamples - 1)) == 0;
+		}
+
+		HarmonicSpectrum::HarmonicSpectrum(size_t numSamples)
+			: m_numSamples(numSamples)
+			, m_real(numSamples / 2 + 1, 0.0)
+			, m_imag(numSamples / 2 + 1, 0.0) {
+		}
+
+		void HarmonicSpectrum::AddPartial(int harmonic, double amplitude, double phase) {
+			// Sampled at n/N, harmonic h is indistinguishable from h mod N; above N/2 it mirrors
+			// to bin N-h with inverted phase: sin(2*PI*(N-m)*t + phase) = -sin(2*PI*m*t - phase)
+			size_t bin = (size_t)std::abs(harmonic) % m_numSamples;
+			if (harmonic < 0) {
+				amplitude = -amplitude;
+				phase = -phase;
+			}
+			if (bin > m_numSamples / 2) {
+				bin = m_numSamples - bin;
+				amplitude = -amplitude;
+				phase = -phase;
+			}
+
+			double size = (double)m_numSamples;
+			if (bin == 0 || bin == m_numSamples / 2) {
+				// DC and Nyquist are real-only: sin(PI*N*t + phase) = (+/-1)^n * sin(phase)
+				m_real[bin] += size * amplitude * std::sin(phase);
+				return;
+			}
+
+			// The inverse FFT scales by 1/N and sums bin k with its mirror N-k, so
+			// X[k] = (N/2) * A * e^(i*(phase - PI/2)) produces A * sin(2*PI*k*t + phase)
+			m_real[bin] += 0.5 * size * amplitude * std::sin(phase);
+			m_imag[bin] -= 0.5 * size * amplitude * std::cos(phase);
+		}
+
+		void HarmonicSpectrum::Render(DSP::IFrequencyProcessor& processor, float* output) const {
+			size_t numBins = m_real.size();
+			std::vector<DSP::ComplexBin> bins(numBins);
+			for (size_t k = 0; k < numBins; ++k) {
+				bins[k] = DSP::ComplexBin((float)m_real[k], (float)m_imag[k]);
+			}
+
+			std::vector<float> timeDomain;
+			processor.Inverse(bins, timeDomain);
+			for (size_t n = 0; n < m_numSamples; ++n)
+				output[n] = timeDomain[n];
+		}
+	}
+}
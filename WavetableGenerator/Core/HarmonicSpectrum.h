@@ -0,0 +1,36 @@
+#ifndef HARMONICSPECTRUM_H
+#define HARMONICSPECTRUM_H
+
+#include <cstddef>
+#include <vector>
+#include "../DSP/IFrequencyProcessor.h"
+
+namespace WavetableGen {
+	namespace Core {
+		// Spectral additive synthesis for integer-harmonic waveforms (Single Responsibility Principle)
+		// Partials are accumulated as half-spectrum bins and the cycle is rendered with a single
+		// inverse real FFT, so the cost is O(N log N) no matter how many harmonics are summed
+		// (the time-domain path is O(N * harmonics) sin() calls).
+		class HarmonicSpectrum {
+		public:
+			// True if a cycle of numSamples can be rendered spectrally (power-of-2 length)
+			static bool Supports(size_t numSamples);
+
+			explicit HarmonicSpectrum(size_t numSamples);
+
+			// Add amplitude * sin(2*PI*harmonic*t + phase)
+			// Harmonics at or above Nyquist fold back exactly as they would when sampled in the time domain
+			void AddPartial(int harmonic, double amplitude, double phase = 0.0);
+
+			// Render one cycle (numSamples values) through the frequency processor's inverse FFT
+			void Render(DSP::IFrequencyProcessor& processor, float* output) const;
+
+		private:
+			size_t m_numSamples;
+			std::vector<double> m_real; // Bins 0..N/2 (unnormalized DFT convention)
+			std::vector<double> m_imag;
+		};
+	}
+}
+
+#endif // HARMONICSPECTRUM_H
@@ -4,7 +4,9 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <memory>
 #include "WaveType.h"
+#include "GenerationContext.h"
 #include "../DSP/WaveformEffects.h"
 
 namespace WavetableGen {
@@ -21,6 +23,7 @@ namespace WavetableGen {
 			virtual ~IWavetableGenerator() = default;
 
 			// Generate a wavetable with the specified parameters
+			// Output depends only on the arguments: the same seed gives bit-identical files
 			virtual GenerationResult GenerateWavetable(
 				const std::vector<std::pair<WaveType, float>>& startWaves,
 				const std::vector<std::pair<WaveType, float>>& endWaves,
@@ -32,7 +35,9 @@ namespace WavetableGen {
 				const EffectsSettings& effects = EffectsSettings(),
 				MorphCurve morphCurve = MorphCurve::Linear,
 				double pulseDuty = 0.5,
-				int maxHarmonics = 8) = 0;
+				int maxHarmonics = 8,
+				uint64_t seed = DEFAULT_GENERATION_SEED,
+				GenerationPrecision precision = GenerationPrecision::Exact) = 0;
 
 			// Generate filename from waveform settings
 			virtual std::string GenerateFilenameFromSettings(
@@ -48,6 +53,10 @@ namespace WavetableGen {
 
 			// Analyze an imported frame using spectral matching (frequency-domain)
 			virtual std::vector<std::pair<WaveType, float>> AnalyzeFrameSpectral(const std::vector<float>& frameData) = 0;
+
+			// Independent generator of the same kind for another thread (Prototype Pattern)
+			// Shared read-only state such as caches may be shared with this instance
+			virtual std::unique_ptr<IWavetableGenerator> Clone() const = 0;
 		};
 	}
 }
@@ -0,0 +1,82 @@
+#include "MorphEngine.h"
+#include "../Utils/SimdVector.h"
+#include <algorithm>
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			// Columns per tile: 16 basis rows x 512 floats = 32 KB, reused by every frame block
+			const size_t TILE_SAMPLES = 512;
+
+			// Frame rows computed together, so each basis load feeds several accumulators
+			const size_t FRAME_BLOCK = 4;
+
+			// A block of frames over one column range [begin, end), scalar
+			// Sums in basis order starting from 0, exactly like a per-frame weighted sum
+			void RenderBlockScalar(const float* weights, size_t blockFrames, size_t numBasis,
+				const float* basis, size_t numSamples, float* frames, size_t begin, size_t end) {
+				for (size_t f = 0; f < blockFrames; ++f) {
+					const float* row = weights + f * numBasis;
+					float* out = frames + f * numSamples;
+					for (size_t i = begin; i < end; ++i) {
+						float acc = 0.0f;
+						for (size_t w = 0; w < numBasis; ++w)
+							acc += row[w] * basis[w * numSamples + i];
+						out[i] = acc;
+					}
+				}
+			}
+
+#if defined(WTG_HAS_SSE2)
+			typedef Utils::VecSSE2 Vec;
+
+			// FRAME_BLOCK frames over one column range: the accumulators stay in registers for the
+			// whole basis sweep, so each output vector is written once
+			void RenderBlockSimd(const float* weights, size_t numBasis,
+				const float* basis, size_t numSamples, float* frames, size_t begin, size_t end) {
+				const float* row0 = weights;
+				const float* row1 = weights + numBasis;
+				const float* row2 = weights + 2 * numBasis;
+				const float* row3 = weights + 3 * numBasis;
+
+				for (size_t i = begin; i < end; i += Vec::Width) {
+					Vec::Reg acc0 = Vec::Set1(0.0f);
+					Vec::Reg acc1 = acc0, acc2 = acc0, acc3 = acc0;
+					for (size_t w = 0; w < numBasis; ++w) {
+						Vec::Reg b = Vec::Load(basis + w * numSamples + i);
+						acc0 = Vec::Add(acc0, Vec::Mul(Vec::Set1(row0[w]), b));
+						acc1 = Vec::Add(acc1, Vec::Mul(Vec::Set1(row1[w]), b));
+						acc2 = Vec::Add(acc2, Vec::Mul(Vec::Set1(row2[w]), b));
+						acc3 = Vec::Add(acc3, Vec::Mul(Vec::Set1(row3[w]), b));
+					}
+					Vec::Store(frames + i, acc0);
+					Vec::Store(frames + numSamples + i, acc1);
+					Vec::Store(frames + 2 * numSamples + i, acc2);
+					Vec::Store(frames + 3 * numSamples + i, acc3);
+				}
+			}
+#endif
+		}
+
+		void MorphEngine::RenderFrames(const float* weights, size_t numFrames, size_t numBasis,
+			const float* basis, size_t numSamples, float* frames) {
+			for (size_t tileStart = 0; tileStart < numSamples; tileStart += TILE_SAMPLES) {
+				size_t tileEnd = std::min(tileStart + TILE_SAMPLES, numSamples);
+
+				size_t frame = 0;
+#if defined(WTG_HAS_SSE2)
+				size_t vectorEnd = tileStart + (tileEnd - tileStart) / Vec::Width * Vec::Width;
+				for (; frame + FRAME_BLOCK <= numFrames; frame += FRAME_BLOCK) {
+					const float* blockWeights = weights + frame * numBasis;
+					float* blockFrames = frames + frame * numSamples;
+					RenderBlockSimd(blockWeights, numBasis, basis, numSamples, blockFrames, tileStart, vectorEnd);
+					RenderBlockScalar(blockWeights, FRAME_BLOCK, numBasis, basis, numSamples, blockFrames, vectorEnd, tileEnd);
+				}
+#endif
+				// Remaining frames (or everything without SIMD)
+				RenderBlockScalar(weights + frame * numBasis, numFrames - frame, numBasis,
+					basis, numSamples, frames + frame * numSamples, tileStart, tileEnd);
+			}
+		}
+	}
+}
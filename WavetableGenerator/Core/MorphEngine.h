@@ -0,0 +1,23 @@
+#ifndef MORPHENGINE_H
+#define MORPHENGINE_H
+
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Core {
+		// Basis-matrix morph engine (Single Responsibility Principle)
+		// Every morph frame is a weighted sum of the same few basis cycles, so a whole wavetable is
+		// one small matrix product: frames (F x N) = weights (F x W) * basis (W x N).
+		class MorphEngine {
+		public:
+			// frames[f][n] = sum over w of weights[f][w] * basis[w][n] (all matrices row-major)
+			// Cache-blocked: a column tile of the basis stays in L1 while every frame is computed
+			// against it, four frames at a time with SSE2 accumulators held in registers.
+			// Each output sample is summed in basis order, exactly like a per-frame weighted sum.
+			static void RenderFrames(const float* weights, size_t numFrames, size_t numBasis,
+				const float* basis, size_t numSamples, float* frames);
+		};
+	}
+}
+
+#endif // MORPHENGINE_H
@@ -1,19 +1,32 @@
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
 #include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include "RandomWavetableGenerator.h"
 #include "WaveGenerator.h"
+#include "../Utils/ThreadPool.h"
 
 namespace WavetableGen {
 	namespace Services {
 		using namespace Core;
 		using namespace Utils;
 
+		namespace {
+			// Tables are written under this suffix and renamed once complete, so an interrupted batch
+			// never leaves an empty .wt/.wav behind that later batches would treat as taken
+			const char* const PARTIAL_SUFFIX = ".part";
+		}
+
 		RandomWavetableGenerator::RandomWavetableGenerator(IWavetableGenerator& wavetableGenerator, XorShift128Plus& rng)
 			: m_wavetableGenerator(wavetableGenerator), m_rng(rng) {
 		}
 
 		// Generate a random selection of waveforms with random weights (from UI-specified available waveforms)
 		std::vector<std::pair<WaveType, float>> RandomWavetableGenerator::GenerateRandomWaveSelection(
+			XorShift128Plus& rng,
 			int minWaves,
 			int maxWaves,
 			const std::vector<AvailableWaveform>& availableWaveforms) {
@@ -28,27 +41,73 @@ namespace WavetableGen {
 			int numAvailable = (int)availableWaveforms.size();
 			int actualMax = (std::min)(maxWaves, numAvailable);
 			int actualMin = (std::min)(minWaves, actualMax);
-			int numWaves = m_rng.NextInt(actualMin, actualMax);
+			int numWaves = rng.NextInt(actualMin, actualMax);
 
 			// Randomly select waveforms (without duplicates)
 			std::vector<bool> used(numAvailable, false);
 			for (int i = 0; i < numWaves; ++i) {
 				int idx;
 				do {
-					idx = m_rng.NextInt(0, numAvailable - 1);
+					idx = rng.NextInt(0, numAvailable - 1);
 				} while (used[idx]);
 				used[idx] = true;
 
 				const AvailableWaveform& available = availableWaveforms[idx];
 
 				// Random weight within the slider range for this waveform
-				float weight = m_rng.NextFloat(available.minWeight, available.maxWeight);
+				float weight = rng.NextFloat(available.minWeight, available.maxWeight);
 				selection.push_back({ available.type, weight });
 			}
 
 			return selection;
 		}
 
+		// State shared by the workers of one batch
+		struct RandomWavetableGenerator::BatchState {
+			std::string outputFolder;
+			int count;
+			int minWaves;
+			int maxWaves;
+			const std::vector<AvailableWaveform>* availableWaveforms;
+			const char* extension;
+			OutputFormat format;
+			bool isAudioPreview;
+			const EffectsSettings* effects;
+			MorphCurve morphCurve;
+			double pulseDuty;
+			int maxHarmonics;
+			std::function<bool(int, int)> progressCallback;
+			GenerationPrecision precision;
+
+			std::atomic<int> reserved{ 0 };  // Tables being generated or done (never exceeds count)
+			std::atomic<int> attempts{ 0 };
+			int maxAttempts = 0;
+			std::atomic<bool> stop{ false }; // Cancelled or fatal error
+
+			std::mutex progressMutex;        // Serializes progressCallback and orders 'generated'
+			int generated = 0;
+		};
+
+		// Create the partial file exclusively; false if the table or its partial file already exists
+		bool RandomWavetableGenerator::ClaimFile(const std::string& path) {
+			if (_access(path.c_str(), 0) == 0) return false;
+
+			// _O_EXCL makes check-and-create one atomic step, so two workers can never claim the same name
+			std::string partialPath = path + PARTIAL_SUFFIX;
+			int fd = _open(partialPath.c_str(), _O_CREAT | _O_EXCL | _O_WRONLY, _S_IREAD | _S_IWRITE);
+			if (fd < 0) return false;
+			_close(fd);
+			return true;
+		}
+
+		// Rename the partial file into place; rename never replaces an existing file on Windows
+		bool RandomWavetableGenerator::PublishFile(const std::string& path) {
+			std::string partialPath = path + PARTIAL_SUFFIX;
+			if (std::rename(partialPath.c_str(), path.c_str()) == 0) return true;
+			_unlink(partialPath.c_str());
+			return false;
+		}
+
 		// Generate multiple random wavetables
 		void RandomWavetableGenerator::GenerateBatch(
 			const std::string& outputFolder,
@@ -63,63 +122,128 @@ namespace WavetableGen {
 			MorphCurve morphCurve,
 			double pulseDuty,
 			int maxHarmonics,
-			std::function<bool(int, int)> progressCallback) {
+			std::function<bool(int, int)> progressCallback,
+			int numWorkers,
+			GenerationPrecision precision) {
 			// If no waveforms are available, cannot generate
-			if (availableWaveforms.empty()) {
+			if (availableWaveforms.empty() || count <= 0) {
+				return;
+			}
+
+			BatchState batch;
+			batch.outputFolder = outputFolder;
+			batch.count = count;
+			batch.minWaves = minWaves;
+			batch.maxWaves = maxWaves;
+			batch.availableWaveforms = &availableWaveforms;
+			batch.extension = extension;
+			batch.format = format;
+			batch.isAudioPreview = isAudioPreview;
+			batch.effects = &effects;
+			batch.morphCurve = morphCurve;
+			batch.pulseDuty = pulseDuty;
+			batch.maxHarmonics = maxHarmonics;
+			batch.progressCallback = progressCallback;
+			batch.precision = precision;
+			batch.maxAttempts = count * 1000; // Safety limit to prevent infinite loops
+
+			ThreadPool& pool = ThreadPool::GetShared();
+			if (numWorkers <= 0) numWorkers = (int)pool.GetConcurrency();
+			numWorkers = (std::min)(numWorkers, count);
+
+			// Single worker: the shared generator and RNG, exactly as a sequential batch
+			if (numWorkers == 1) {
+				RunBatchWorker(batch, m_wavetableGenerator, m_rng);
 				return;
 			}
 
+			// Otherwise every worker gets its own generator and an independent RNG stream
+			std::vector<std::unique_ptr<IWavetableGenerator>> generators;
+			std::vector<XorShift128Plus> rngs;
+			for (int i = 0; i < numWorkers; ++i) {
+				generators.push_back(m_wavetableGenerator.Clone());
+				uint64_t seed = m_rng.Next();
+				rngs.emplace_back(seed != 0 ? seed : 1);
+			}
+
+			// Workers run as pool tasks: frame-level parallelism inside each table then uses
+			// whatever threads are left idle instead of oversubscribing the machine
+			pool.ParallelFor(0, (size_t)numWorkers, 1, [&](size_t first, size_t last) {
+				for (size_t i = first; i < last; ++i)
+					RunBatchWorker(batch, *generators[i], rngs[i]);
+			});
+		}
+
+		// Generate tables until the batch is complete, cancelled or out of attempts
+		void RandomWavetableGenerator::RunBatchWorker(BatchState& batch, IWavetableGenerator& generator, XorShift128Plus& rng) {
 			// Random frame counts for morphing
 			int frameOptions[] = { 64, 128, 256, 512 };
 
-			int generatedCount = 0;
-			int maxAttempts = count * 1000; // Safety limit to prevent infinite loops
-			int attempts = 0;
-
-			while (generatedCount < count && attempts < maxAttempts) {
-				attempts++;
+			while (!batch.stop && batch.attempts++ < batch.maxAttempts) {
+				// Reserve a slot first, so concurrent workers never overshoot the requested count
+				if (batch.reserved++ >= batch.count) {
+					batch.reserved--;
+					break;
+				}
 
 				// Random morphing enabled/disabled per wavetable (70% chance of morphing)
-				bool enableMorphing = m_rng.NextBool(0.7f);
+				bool enableMorphing = rng.NextBool(0.7f);
 
 				// Generate random start waveform selection
-				auto startWaves = GenerateRandomWaveSelection(minWaves, maxWaves, availableWaveforms);
+				auto startWaves = GenerateRandomWaveSelection(rng, batch.minWaves, batch.maxWaves, *batch.availableWaveforms);
 
 				// Generate random end waveform selection
-				auto endWaves = GenerateRandomWaveSelection(minWaves, maxWaves, availableWaveforms);
+				auto endWaves = GenerateRandomWaveSelection(rng, batch.minWaves, batch.maxWaves, *batch.availableWaveforms);
 
 				// Random number of frames
-				int numFrames = frameOptions[m_rng.NextInt(0, 3)];
+				int numFrames = frameOptions[rng.NextInt(0, 3)];
+
+				// Per-file seed for randomized waves and effects (the whole batch replays from the batch RNG's seed)
+				uint64_t seed = rng.Next();
 
 				// Generate filename from start and end wave settings (include effects)
-				std::string baseFilename = m_wavetableGenerator.GenerateFilenameFromSettings(startWaves, endWaves, enableMorphing, effects, morphCurve, pulseDuty);
-				std::string fullPath = outputFolder + baseFilename + extension;
+				std::string baseFilename = generator.GenerateFilenameFromSettings(startWaves, endWaves, enableMorphing, *batch.effects, batch.morphCurve, batch.pulseDuty);
+				std::string fullPath = batch.outputFolder + baseFilename + batch.extension;
 
-				// Check if file already exists (_access returns 0 if file exists)
-				if (_access(fullPath.c_str(), 0) == 0) {
-					// File exists, try another random combination
+				// Claim the file name; if it already exists, try another random combination
+				if (!ClaimFile(fullPath)) {
+					batch.reserved--;
 					continue;
 				}
 
-				// File doesn't exist, generate it
-				GenerationResult result = m_wavetableGenerator.GenerateWavetable(startWaves, endWaves, fullPath, format, isAudioPreview, enableMorphing, numFrames, effects, morphCurve, pulseDuty, maxHarmonics);
+				// Name is ours, generate the table into its partial file
+				std::string partialPath = fullPath + PARTIAL_SUFFIX;
+				GenerationResult result = generator.GenerateWavetable(startWaves, endWaves, partialPath, batch.format, batch.isAudioPreview, enableMorphing, numFrames, *batch.effects, batch.morphCurve, batch.pulseDuty, batch.maxHarmonics, seed, batch.precision);
 
 				// Check result
 				if (result == GenerationResult::Success) {
-					generatedCount++;
+					// Complete: give it the table name, or retry if another process took the name meanwhile
+					if (!PublishFile(fullPath)) {
+						batch.reserved--;
+						continue;
+					}
+
+					std::lock_guard<std::mutex> lock(batch.progressMutex);
+					batch.generated++;
 
 					// Call progress callback if provided
-					if (progressCallback) {
-						bool shouldContinue = progressCallback(generatedCount, count);
+					if (batch.progressCallback && !batch.stop) {
+						bool shouldContinue = batch.progressCallback(batch.generated, batch.count);
 						if (!shouldContinue) {
 							// User cancelled generation
-							break;
+							batch.stop = true;
 						}
 					}
+					continue;
 				}
-				else if (result == GenerationResult::ErrorFileOpenFailed) {
+
+				// Release the name and the slot
+				_unlink(partialPath.c_str());
+				batch.reserved--;
+
+				if (result == GenerationResult::ErrorFileOpenFailed) {
 					// Fatal error - can't write to output folder, stop immediately
-					break;
+					batch.stop = true;
 				}
 				// For other errors (empty waveforms, invalid samples, etc.), continue trying other combinations
 			}
@@ -26,6 +26,9 @@ namespace WavetableGen {
 			~RandomWavetableGenerator() = default;
 
 			// Generate multiple random wavetables
+			// numWorkers: tables generated concurrently (0 = one per hardware thread). With more than one
+			// worker, each runs its own generator clone and an RNG stream seeded from the shared RNG;
+			// progressCallback is then called from the workers, but never concurrently.
 			void GenerateBatch(
 				const std::string& outputFolder,
 				int count,
@@ -39,14 +42,31 @@ namespace WavetableGen {
 				MorphCurve morphCurve,
 				double pulseDuty,
 				int maxHarmonics = 8,
-				std::function<bool(int, int)> progressCallback = nullptr);
+				std::function<bool(int, int)> progressCallback = nullptr,
+				int numWorkers = 1,
+				GenerationPrecision precision = GenerationPrecision::Exact);
 
 		private:
+			// State shared by the workers of one batch
+			struct BatchState;
+
 			std::vector<std::pair<WaveType, float>> GenerateRandomWaveSelection(
+				XorShift128Plus& rng,
 				int minWaves,
 				int maxWaves,
 				const std::vector<AvailableWaveform>& availableWaveforms);
 
+			// Generate tables until the batch is complete, cancelled or out of attempts
+			void RunBatchWorker(BatchState& batch, IWavetableGenerator& generator, XorShift128Plus& rng);
+
+			// Claim a table name by creating its partial file exclusively; false if the table or its
+			// partial file already exists (another worker or earlier batch)
+			static bool ClaimFile(const std::string& path);
+
+			// Move a finished partial file to the table name; false (and the partial file removed) if
+			// the name was taken in the meantime
+			static bool PublishFile(const std::string& path);
+
 			IWavetableGenerator& m_wavetableGenerator;
 			XorShift128Plus& m_rng;
 		};
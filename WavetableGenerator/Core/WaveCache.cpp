@@ -0,0 +1,81 @@
+#include "WaveCache.h"
+#include <cstring>
+
+namespace WavetableGen {
+	namespace Core {
+		WaveCache::WaveCache(size_t capacity)
+			: m_capacity(capacity > 0 ? capacity : 1)
+			, m_hits(0)
+			, m_misses(0)
+			, m_evictions(0) {
+		}
+
+		size_t WaveCache::KeyHash::operator()(const WaveCacheKey& key) const {
+			uint64_t dutyBits;
+			std::memcpy(&dutyBits, &key.pulseDuty, sizeof(dutyBits));
+
+			// FNV-1a style mixing of the key fields
+			uint64_t hash = 1469598103934665603ull;
+			const uint64_t fields[] = { (uint64_t)key.type, (uint64_t)key.numSamples, dutyBits, (uint64_t)(uint32_t)key.maxHarmonics, key.seed, (uint64_t)key.precision };
+			for (uint64_t field : fields) {
+				hash ^= field;
+				hash *= 1099511628211ull;
+			}
+			return (size_t)(hash ^ (hash >> 32));
+		}
+
+		WaveCache::WaveBuffer WaveCache::GetOrCreate(const WaveCacheKey& key,
+			const std::function<std::vector<float>()>& generate) {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				auto found = m_index.find(key);
+				if (found != m_index.end()) {
+					m_entries.splice(m_entries.begin(), m_entries, found->second);
+					m_hits++;
+					return found->second->second;
+				}
+			}
+
+			m_misses++;
+			WaveBuffer buffer = std::make_shared<const std::vector<float>>(generate());
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// Another thread may have rendered the same cycle meanwhile; keep the first one
+			auto found = m_index.find(key);
+			if (found != m_index.end()) {
+				m_entries.splice(m_entries.begin(), m_entries, found->second);
+				return found->second->second;
+			}
+
+			m_entries.emplace_front(key, buffer);
+			m_index[key] = m_entries.begin();
+
+			while (m_entries.size() > m_capacity) {
+				m_index.erase(m_entries.back().first);
+				m_entries.pop_back();
+				m_evictions++;
+			}
+
+			return buffer;
+		}
+
+		void WaveCache::Clear() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_index.clear();
+			m_entries.clear();
+		}
+
+		WaveCacheStats WaveCache::GetStats() const {
+			WaveCacheStats stats;
+			stats.hits = m_hits.load();
+			stats.misses = m_misses.load();
+			stats.evictions = m_evictions.load();
+			stats.capacity = m_capacity;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			stats.entries = m_entries.size();
+			return stats;
+		}
+	}
+}
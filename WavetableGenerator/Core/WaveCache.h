@@ -0,0 +1,83 @@
+#ifndef WAVECACHE_H
+#define WAVECACHE_H
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+#include "WaveType.h"
+#include "GenerationContext.h"
+
+namespace WavetableGen {
+	namespace Core {
+		// Everything a generated basis cycle depends on
+		struct WaveCacheKey {
+			WaveType type;
+			size_t numSamples;
+			double pulseDuty;
+			int maxHarmonics;
+			uint64_t seed; // Only for randomized types (WaveKernels::UsesSeed), 0 otherwise
+			GenerationPrecision precision;
+
+			bool operator==(const WaveCacheKey& other) const {
+				return type == other.type && numSamples == other.numSamples &&
+					pulseDuty == other.pulseDuty && maxHarmonics == other.maxHarmonics &&
+					seed == other.seed && precision == other.precision;
+			}
+		};
+
+		// Cache counters (snapshot)
+		struct WaveCacheStats {
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			uint64_t evictions = 0;
+			size_t entries = 0;
+			size_t capacity = 0;
+		};
+
+		// Bounded, thread-safe memoization of generated basis cycles (Single Responsibility Principle)
+		// Buffers are immutable and shared, so a hit costs a lookup and a reference count instead of
+		// re-rendering the cycle. Least recently used entries are evicted once capacity is reached.
+		// One cache can be shared by several generators (e.g. batch workers) via shared_ptr.
+		class WaveCache {
+		public:
+			typedef std::shared_ptr<const std::vector<float>> WaveBuffer;
+
+			// Default capacity: 256 cycles (2 MB at 2048 samples)
+			static constexpr size_t DEFAULT_CAPACITY = 256;
+
+			explicit WaveCache(size_t capacity = DEFAULT_CAPACITY);
+
+			// Return the cached cycle for key, or render it with generate() and cache it
+			// generate() runs without the lock held, so concurrent misses do not serialize
+			WaveBuffer GetOrCreate(const WaveCacheKey& key, const std::function<std::vector<float>()>& generate);
+
+			// Drop all entries (counters are kept)
+			void Clear();
+
+			WaveCacheStats GetStats() const;
+
+		private:
+			struct KeyHash {
+				size_t operator()(const WaveCacheKey& key) const;
+			};
+
+			typedef std::list<std::pair<WaveCacheKey, WaveBuffer>> EntryList;
+
+			size_t m_capacity;
+			mutable std::mutex m_mutex;
+			EntryList m_entries; // Most recently used first
+			std::unordered_map<WaveCacheKey, EntryList::iterator, KeyHash> m_index;
+
+			std::atomic<uint64_t> m_hits;
+			std::atomic<uint64_t> m_misses;
+			std::atomic<uint64_t> m_evictions;
+		};
+	}
+}
+
+#endif // WAVECACHE_H
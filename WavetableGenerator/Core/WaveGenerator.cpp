@@ -1,7 +1,10 @@
 #include "WaveGenerator.h"
 #include "../IO/FileWriterFactory.h"
-#include "../DSP/KissFFTProcessor.h"
+#include "../DSP/FrequencyProcessorFactory.h"
+#include "../DSP/EffectChain.h"
 #include "WaveTypeName.h"
+#include "WaveKernels.h"
+#include "MorphEngine.h"
 #include <cmath>
 #include <cstring>
 #include <fstream>
@@ -12,862 +15,89 @@ namespace WavetableGen {
 	namespace Core {
 		using namespace IO;
 
-		// PolyBLEP (Polynomial Band-Limited Step) for anti-aliasing
-		float WaveGenerator::PolyBLEP(float t, float dt) {
-			if (t < dt) {
-				t = t / dt;
-				return t + t - t * t - 1.0f;
-			}
-			else if (t > 1.0f - dt) {
-				t = (t - 1.0f) / dt;
-				return t * t + t + t + 1.0f;
-			}
-			return 0.0f;
+		// Frames per parallel task when rendering the morph matrix (a multiple of MorphEngine's frame block)
+		static const size_t RENDER_FRAMES_PER_TASK = 8;
+
+		WaveGenerator::WaveGenerator(std::shared_ptr<WaveCache> waveCache, Utils::ThreadPool* threadPool)
+			: m_waveCache(waveCache ? waveCache : std::make_shared<WaveCache>())
+			, m_threadPool(threadPool ? threadPool : &Utils::ThreadPool::GetShared()) {
+		}
+
+		std::unique_ptr<IWavetableGenerator> WaveGenerator::Clone() const {
+			return std::unique_ptr<IWavetableGenerator>(new WaveGenerator(m_waveCache, m_threadPool));
 		}
 
 		// Generate a single waveform cycle (bandlimited)
 		std::vector<float> WaveGenerator::GenerateWave(
 			WaveType type,
 			size_t numSamples,
-			double pulseDuty,
-			int maxHarmonics
+			const GenerationContext& context
 		) {
 			std::vector<float> samples(numSamples);
-			float dt = 1.0f / (float)numSamples;
-
-			for (size_t n = 0; n < numSamples; ++n) {
-				double t = (double)n / numSamples;
-				float val = 0.0f;
-
-				switch (type) {
-					// ===== TAB 0: BASIC WAVES =====
-				case WaveType::Sine:
-					samples[n] = (float)sin(2 * PI * t);
-					break;
-
-				case WaveType::Square: {
-					float value = (float)t < 0.5f ? 1.0f : -1.0f;
-					value -= PolyBLEP((float)t, dt);
-					value += PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Triangle: {
-					float value = 1.0f - 4.0f * std::abs((float)t - 0.5f);
-					value += dt * PolyBLEP((float)t, dt);
-					value -= dt * PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Saw: {
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::ReverseSaw: {
-					float value = 1.0f - 2.0f * (float)t;
-					value += 2.0f * PolyBLEP((float)t, dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Pulse: {
-					float value = (float)t < pulseDuty ? 1.0f : -1.0f;
-					value -= PolyBLEP((float)t, dt);
-					value += PolyBLEP(fmodf((float)t - (float)pulseDuty + 1.0f, 1.0f), dt);
-					samples[n] = value;
-					break;
-				}
-
-				// ===== TAB 1: CHAOS THEORY =====
-				case WaveType::Lorenz: {
-					// Lorenz attractor - project X coordinate
-					float sigma = 10.0f, rho = 28.0f, beta = 8.0f / 3.0f;
-					float x = 0.1f, y = 0.0f, z = 0.0f;
-					float dt_sim = 0.01f;
-
-					// Run simulation to get to this point in cycle
-					int steps = (int)(t * 200.0f);
-					for (int s = 0; s < steps; ++s) {
-						float dx = sigma * (y - x);
-						float dy = x * (rho - z) - y;
-						float dz = x * y - beta * z;
-						x += dx * dt_sim;
-						y += dy * dt_sim;
-						z += dz * dt_sim;
-					}
-					samples[n] = std::tanh(x / 15.0f); // Normalize
-					break;
-				}
-
-				case WaveType::Rossler: {
-					// Rössler attractor - project X coordinate
-					float a = 0.2f, b = 0.2f, c = 5.7f;
-					float x = 0.1f, y = 0.0f, z = 0.0f;
-					float dt_sim = 0.05f;
-
-					int steps = (int)(t * 100.0f);
-					for (int s = 0; s < steps; ++s) {
-						float dx = -y - z;
-						float dy = x + a * y;
-						float dz = b + z * (x - c);
-						x += dx * dt_sim;
-						y += dy * dt_sim;
-						z += dz * dt_sim;
-					}
-					samples[n] = std::tanh(x / 5.0f);
-					break;
-				}
-
-				case WaveType::Henon: {
-					// Hénon map
-					float a = 1.4f, b = 0.3f;
-					float x = 0.1f, y = 0.1f;
-
-					int iterations = (int)(t * 50.0f);
-					for (int i = 0; i < iterations; ++i) {
-						float xnew = 1.0f - a * x * x + y;
-						y = b * x;
-						x = xnew;
-					}
-					samples[n] = std::tanh(x);
-					break;
-				}
-
-				case WaveType::Duffing: {
-					// Duffing oscillator - forced nonlinear oscillator
-					float alpha = -1.0f, beta = 1.0f, delta = 0.3f, gamma = 0.37f, omega = 1.2f;
-					float x = 0.1f, v = 0.0f;
-					float dt_sim = 0.05f;
-					float time = (float)t * 10.0f;
-
-					for (float t_sim = 0; t_sim < time; t_sim += dt_sim) {
-						float force = gamma * (float)cos(omega * t_sim);
-						float dv = -delta * v - alpha * x - beta * x * x * x + force;
-						v += dv * dt_sim;
-						x += v * dt_sim;
-					}
-					samples[n] = std::tanh(x);
-					break;
-				}
-
-				case WaveType::Chua: {
-					// Chua's circuit - simplified version
-					float alpha = 15.6f, beta = 28.0f;
-					float x = 0.1f, y = 0.0f, z = 0.0f;
-					float dt_sim = 0.01f;
-
-					int steps = (int)(t * 150.0f);
-					for (int s = 0; s < steps; ++s) {
-						float h = -1.143f * x + 0.714f * (std::abs(x + 1.0f) - std::abs(x - 1.0f));
-						float dx = alpha * (y - x - h);
-						float dy = x - y + z;
-						float dz = -beta * y;
-						x += dx * dt_sim;
-						y += dy * dt_sim;
-						z += dz * dt_sim;
-					}
-					samples[n] = std::tanh(x / 2.0f);
-					break;
-				}
-
-				case WaveType::LogisticChaos: {
-					// Logistic map in chaotic regime (r = 3.9)
-					float r = 3.9f;
-					float x = 0.5f;
-
-					int iterations = (int)(t * 100.0f) + 50; // Skip transient
-					for (int i = 0; i < iterations; ++i) {
-						x = r * x * (1.0f - x);
-					}
-					samples[n] = (x - 0.5f) * 2.0f;
-					break;
-				}
-
-				// ===== TAB 2: FRACTALS =====
-				case WaveType::Weierstrass: {
-					// Weierstrass function: sum of cos(b^n * pi * x) * a^n
-					// a controls smoothness (0 < a < 1), b must be odd integer
-					float a = 0.5f; // Smoothness parameter
-					int b = 7;      // Frequency multiplier (odd)
-					int iterations = 8;
-
-					float weierstrassVal = 0.0f;
-					float a_n = 1.0f;
-					int b_n = 1;
-
-					for (int k = 0; k < iterations; ++k) {
-						weierstrassVal += a_n * (float)cos(b_n * PI * t);
-						a_n *= a;
-						b_n *= b;
-					}
-					samples[n] = weierstrassVal;
-					break;
-				}
-
-				case WaveType::Cantor: {
-					// Cantor (Devil's Staircase) function
-					float cantorVal = 0.0f;
-					float tScaled = fmodf((float)t, 1.0f);
-					int iterations = 6;
-
-					for (int k = 0; k < iterations; ++k) {
-						float power = (float)pow(3.0, k);
-						float segment = fmodf(tScaled * power, 1.0f);
-
-						if (segment < 0.333f) {
-							cantorVal += 0.0f / power;
-						}
-						else if (segment > 0.666f) {
-							cantorVal += 1.0f / power;
-						}
-						else {
-							cantorVal += 0.5f / power;
-						}
-					}
-					samples[n] = (cantorVal - 0.5f) * 2.0f; // Center around zero
-					break;
-				}
-
-				case WaveType::Koch: {
-					// Koch curve projection - creates crystalline patterns
-					float kochVal = 0.0f;
-					int iterations = 5;
-
-					for (int k = 1; k <= iterations; ++k) {
-						float freq = (float)pow(4.0, k - 1);
-						float amp = 1.0f / freq;
-						// Create angular, fractal pattern
-						float phase = fmodf((float)t * freq, 1.0f);
-						if (phase < 0.25f) {
-							kochVal += amp * (phase * 4.0f);
-						}
-						else if (phase < 0.5f) {
-							kochVal += amp * (2.0f - phase * 4.0f);
-						}
-						else if (phase < 0.75f) {
-							kochVal += amp * ((phase - 0.5f) * 4.0f);
-						}
-						else {
-							kochVal += amp * (1.0f - (phase - 0.75f) * 4.0f);
-						}
-					}
-					samples[n] = (kochVal - 0.5f) * 2.0f;
-					break;
-				}
-
-				case WaveType::Mandelbrot: {
-					// Sample from Mandelbrot set boundary
-					// Map waveform position to complex plane
-					float cReal = -0.7f + (float)t * 0.6f; // Scan interesting region
-					float cImag = 0.0f;
-
-					float zReal = 0.0f;
-					float zImag = 0.0f;
-					int maxIterations = 20;
-					int iteration = 0;
-
-					// Mandelbrot iteration: z = z^2 + c
-					while (iteration < maxIterations && (zReal * zReal + zImag * zImag) < 4.0f) {
-						float zRealNew = zReal * zReal - zImag * zImag + cReal;
-						float zImagNew = 2.0f * zReal * zImag + cImag;
-						zReal = zRealNew;
-						zImag = zImagNew;
-						iteration++;
-					}
-
-					// Use iteration count to create waveform
-					float mandelbrotVal = (float)iteration / (float)maxIterations;
-					samples[n] = (mandelbrotVal - 0.5f) * 2.0f;
-					break;
-				}
-
-				// ===== TAB 3: HARMONIC WAVES =====
-				case WaveType::OddHarmonics:
-					for (int k = 1; k <= maxHarmonics * 2; k += 2) {
-						if (k <= maxHarmonics * 2 - 1)
-							val += (float)sin(2 * PI * k * t) / k;
-					}
-					samples[n] = val;
-					break;
-
-				case WaveType::EvenHarmonics:
-					for (int k = 2; k <= maxHarmonics; k += 2) {
-						val += (float)sin(2 * PI * k * t) / k;
-					}
-					samples[n] = val;
-					break;
-
-				case WaveType::HarmonicSeries:
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						val += (float)sin(2 * PI * k * t) / k;
-					}
-					samples[n] = val;
-					break;
-
-				case WaveType::SubHarmonics:
-					val = (float)sin(2 * PI * t);
-					val += 0.5f * (float)sin(2 * PI * t + PI / 2.0);
-					val += 0.25f * (float)sin(2 * PI * t + PI);
-					samples[n] = val;
-					break;
-
-				case WaveType::Formant: {
-					// Bandlimited vocal formants
-					val = 0.0f;
-					val += (float)sin(2 * PI * 2 * t);
-					val += (float)sin(2 * PI * 3 * t) * 0.7f;
-					samples[n] = val;
-					break;
-				}
-
-				case WaveType::Additive:
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						val += (float)sin(2 * PI * k * t) / k;
-					}
-					samples[n] = val;
-					break;
-
-				// ===== TAB 4: INHARMONIC SERIES =====
-				case WaveType::StretchedHarm: {
-					// Harmonics stretched wider than natural
-					val = 0.0f;
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						float stretch = (float)pow(k, 1.05); // Slightly stretched
-						val += (float)sin(2 * PI * stretch * t) / k;
-					}
-					samples[n] = val;
-					break;
-				}
-
-				case WaveType::CompressedHarm: {
-					// Harmonics compressed closer together
-					val = 0.0f;
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						float compress = (float)pow(k, 0.95); // Slightly compressed
-						val += (float)sin(2 * PI * compress * t) / k;
-					}
-					samples[n] = val;
-					break;
-				}
-
-				case WaveType::Metallic: {
-					// Bell-like inharmonic overtones
-					val = (float)sin(2 * PI * t); // Fundamental
-					val += 0.5f * (float)sin(2 * PI * 2.76f * t); // Inharmonic partial
-					val += 0.3f * (float)sin(2 * PI * 5.40f * t);
-					val += 0.2f * (float)sin(2 * PI * 8.93f * t);
-					samples[n] = val / 2.0f;
-					break;
-				}
-
-				case WaveType::Clangorous: {
-					// Gong/cymbal-like inharmonic spectrum
-					val = (float)sin(2 * PI * t);
-					val += 0.6f * (float)sin(2 * PI * 1.593f * t);
-					val += 0.4f * (float)sin(2 * PI * 2.136f * t);
-					val += 0.3f * (float)sin(2 * PI * 2.653f * t);
-					val += 0.2f * (float)sin(2 * PI * 3.593f * t);
-					samples[n] = val / 2.5f;
-					break;
-				}
-
-				case WaveType::KarplusStrong: {
-					// Karplus-Strong plucked string algorithm
-					static std::vector<float> delayLine;
-					int delayLength = 50; // Short delay for higher pitch
-
-					if (n == 0) {
-						// Initialize with noise burst
-						delayLine.clear();
-						delayLine.resize(delayLength);
-						for (int i = 0; i < delayLength; ++i) {
-							delayLine[i] = ((float)rand() / RAND_MAX) * 2.0f - 1.0f;
-						}
-					}
-
-					// Karplus-Strong averaging filter
-					float output = delayLine[n % delayLength];
-					float next = (output + delayLine[(n + 1) % delayLength]) * 0.5f * 0.996f; // Damping
-					delayLine[n % delayLength] = next;
-					samples[n] = output;
-					break;
-				}
-
-				case WaveType::StiffString: {
-					// Piano-like inharmonicity (f_n = n * f0 * sqrt(1 + B*n^2))
-					val = 0.0f;
-					float B = 0.0001f; // Inharmonicity coefficient
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						float freq = (float)k * (float)sqrt(1.0f + B * k * k);
-						val += (float)sin(2 * PI * freq * t) / k;
-					}
-					samples[n] = val;
-					break;
-				}
-
-				// ===== TAB 5: MODERN/DIGITAL + MATHEMATICAL =====
-				case WaveType::Supersaw: {
-					// Bandlimited supersaw
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					value += 0.2f * (float)sin(2 * PI * 2 * t);
-					value += 0.1f * (float)sin(2 * PI * 3 * t);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::PWMSaw: {
-					double duty = 0.25;
-					float value = (float)t < duty ? 1.0f : -1.0f;
-					value -= PolyBLEP((float)t, dt);
-					value += PolyBLEP(fmodf((float)t - (float)duty + 1.0f, 1.0f), dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Parabolic:
-					samples[n] = 1.0f - 4.0f * (float)((t - 0.5) * (t - 0.5));
-					break;
-
-				case WaveType::DoubleSine:
-					samples[n] = (float)sin(2 * PI * t) * (float)cos(2 * PI * t);
-					break;
-
-				case WaveType::HalfSine:
-					samples[n] = (float)std::abs(sin(2 * PI * t)) * 2.0f - 1.0f;
-					break;
-
-				case WaveType::Trapezoid: {
-					float slope = 0.2f;
-					float value;
-					if (t < slope)
-						value = (float)t / slope * 2.0f - 1.0f;
-					else if (t < 0.5f)
-						value = 1.0f;
-					else if (t < 0.5f + slope)
-						value = 1.0f - ((float)t - 0.5f) / slope * 2.0f;
-					else
-						value = -1.0f;
-					value += dt * PolyBLEP((float)t, dt);
-					value -= dt * PolyBLEP(fmodf((float)t - slope, 1.0f), dt);
-					value -= dt * PolyBLEP(fmodf((float)t - 0.5f, 1.0f), dt);
-					value += dt * PolyBLEP(fmodf((float)t - 0.5f - slope, 1.0f), dt);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Power: {
-					float phase = (float)t * 2.0f;
-					float x;
-					if (phase < 1.0f) {
-						x = phase;
-						samples[n] = std::pow(x, 1.5f) * 2.0f - 1.0f;
-					}
-					else {
-						x = phase - 1.0f;
-						samples[n] = 1.0f - std::pow(x, 1.5f) * 2.0f;
-					}
-					break;
-				}
-
-				case WaveType::Exponential: {
-					float phase = (float)t * 2.0f;
-					if (phase < 1.0f) {
-						samples[n] = 2.0f * (std::exp(phase) - 1.0f) / (std::exp(1.0f) - 1.0f) - 1.0f;
-					}
-					else {
-						float x = phase - 1.0f;
-						samples[n] = 1.0f - 2.0f * (std::exp(x) - 1.0f) / (std::exp(1.0f) - 1.0f);
-					}
-					break;
-				}
-
-				case WaveType::Logistic: {
-					float phase = (float)t * 2.0f;
-					if (phase < 1.0f) {
-						float x = phase * 12.0f - 6.0f;
-						float logistic = 1.0f / (1.0f + std::exp(-x));
-						samples[n] = (logistic - 0.5f) * 2.0f;
-					}
-					else {
-						float x = (phase - 1.0f) * 12.0f - 6.0f;
-						float logistic = 1.0f / (1.0f + std::exp(-x));
-						samples[n] = (0.5f - logistic) * 2.0f;
-					}
-					break;
-				}
-
-				case WaveType::Stepped: {
-					int step = (int)(t * 8.0f) % 8;
-					samples[n] = (step / 3.5f) - 1.0f;
-					break;
-				}
-
-				case WaveType::Noise: {
-					float noiseVal = 0.0f;
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						float phaseOffset = (float)(k * 123456789u % 1000) / 1000.0f;
-						float amplitude = 1.0f / (float)k;
-						noiseVal += amplitude * (float)sin(2 * PI * k * t + phaseOffset * 2 * PI);
-					}
-					samples[n] = noiseVal;
-					break;
-				}
-
-				case WaveType::Procedural:
-					samples[n] = (float)std::tanh(3.0 * sin(2 * PI * t));
-					break;
-
-				case WaveType::Sinc: {
-					// Sinc function: sin(x)/x
-					// Map t (0..1) to range -8PI to 8PI to show multiple lobes
-					float x = ((float)t - 0.5f) * 16.0f * (float)PI;
-					if (std::abs(x) < 0.001f) {
-						samples[n] = 1.0f;
-					}
-					else {
-						samples[n] = (float)sin(x) / x;
-					}
-					break;
-				}
-
-				// ===== TAB 6: MODULATION SYNTHESIS =====
-				case WaveType::RingMod: {
-					// Ring modulation - classic metallic sound
-					float carrier = (float)sin(2 * PI * t);
-					float modulator = (float)sin(2 * PI * 3.7f * t); // Inharmonic ratio
-					samples[n] = carrier * modulator;
-					break;
-				}
-
-				case WaveType::AmplitudeMod: {
-					// Amplitude modulation
-					float carrier = (float)sin(2 * PI * t);
-					float modulator = (float)sin(2 * PI * 0.3f * t); // Slow modulation
-					samples[n] = carrier * (0.5f + 0.5f * modulator);
-					break;
-				}
-
-				case WaveType::FrequencyMod: {
-					// Deep FM synthesis
-					float modIndex = 2.0f;
-					float ratio = 2.5f; // C:M ratio
-					float modulator = modIndex * (float)sin(2 * PI * ratio * t);
-					samples[n] = (float)sin(2 * PI * t + modulator);
-					break;
-				}
-
-				case WaveType::CrossMod: {
-					// Cross modulation - bidirectional FM
-					float mod1 = (float)sin(2 * PI * t);
-					float mod2 = (float)sin(2 * PI * 1.5f * t);
-					float result1 = (float)sin(2 * PI * t + mod2 * 0.5f);
-					float result2 = (float)sin(2 * PI * 1.5f * t + mod1 * 0.5f);
-					samples[n] = (result1 + result2) * 0.5f;
-					break;
-				}
 
-				case WaveType::PhaseMod: {
-					// Phase modulation synthesis
-					float modIndex = 1.5f;
-					float ratio = 3.0f;
-					float modulator = modIndex * (float)sin(2 * PI * ratio * t);
-					samples[n] = (float)sin(2 * PI * t + modulator);
-					break;
-				}
-
-				// ===== TAB 7: PHYSICAL MODELS =====
-				case WaveType::String:
-					for (int k = 1; k <= maxHarmonics; ++k) {
-						val += (float)sin(2 * PI * k * t) / (k * k);
-					}
-					samples[n] = val;
-					break;
+			// Select the kernel once, then render the whole cycle in one pass
+			WaveKernelParams params;
+			params.numSamples = numSamples;
+			params.pulseDuty = context.pulseDuty;
+			params.maxHarmonics = context.maxHarmonics;
+			params.seed = context.WaveSeed(type);
 
-				case WaveType::Brass:
-					for (int k = 1; k <= maxHarmonics * 2 - 1; k += 2) {
-						if (k <= maxHarmonics)
-							val += (float)sin(2 * PI * k * t) / (k * 0.8f);
-					}
-					samples[n] = val;
-					break;
-
-				case WaveType::Reed:
-					// Bandlimited clarinet-like (odd harmonics)
-					val = (float)sin(2 * PI * t);
-					val += 0.3f * (float)sin(2 * PI * 3 * t);
-					samples[n] = val;
-					break;
-
-				case WaveType::Vocal: {
-					// Bandlimited vowel formants
-					val = 0.0f;
-					val += (float)sin(2 * PI * 2 * t) * 1.0f;
-					val += (float)sin(2 * PI * 3 * t) * 0.6f;
-					samples[n] = val;
-					break;
-				}
-
-				case WaveType::Bell:
-					// Bandlimited bell-like
-					val = (float)sin(2 * PI * t);
-					val += 0.5f * (float)sin(2 * PI * 2 * t);
-					val += 0.35f * (float)sin(2 * PI * 3 * t);
-					samples[n] = val;
-					break;
-
-				// ===== TAB 8: SYNTHESIS WAVES =====
-				case WaveType::SimpleFM: {
-					// Reduced modulation index for bandlimiting
-					float carrier = (float)(2 * PI * t);
-					float modIndex = 0.3f;
-					float modulator = (float)sin(2 * PI * 2 * t) * modIndex;
-					samples[n] = (float)sin(carrier + modulator);
-					break;
-				}
+			// Integer-harmonic waves are rendered with one inverse FFT of the cycle length
+			if (!m_additiveFFT)
+				m_additiveFFT = DSP::FrequencyProcessorFactory::Create(SAMPLES_PER_WAVE);
+			params.frequencyProcessor = m_additiveFFT.get();
 
-				case WaveType::ComplexFM: {
-					// Reduced modulation for bandlimiting
-					float carrier = (float)(2 * PI * t);
-					float modIndex1 = 0.2f;
-					float modIndex2 = 0.15f;
-					float mod1 = (float)sin(2 * PI * 2 * t) * modIndex1;
-					float mod2 = (float)sin(2 * PI * 3 * t) * modIndex2;
-					samples[n] = (float)sin(carrier + mod1 + mod2);
-					break;
-				}
-
-				case WaveType::PhaseDistortion: {
-					// Reduced phase modulation for bandlimiting
-					double phaseMod = 0.08;
-					double phase = t + phaseMod * sin(2 * PI * t);
-					samples[n] = (float)sin(2 * PI * phase);
-					break;
-				}
-
-				case WaveType::Wavefold: {
-					// Reduced wavefolding for bandlimiting
-					float amplitude = 1.3f;
-					float x = (float)sin(2 * PI * t) * amplitude;
-					x = x > 1.0f ? 2.0f - x : x;
-					x = x < -1.0f ? -2.0f - x : x;
-					samples[n] = x;
-					break;
-				}
-
-				case WaveType::HardSync: {
-					// Bandlimited hard sync
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					value += 0.4f * (float)sin(2 * PI * 2 * t);
-					value += 0.2f * (float)sin(2 * PI * 3 * t);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::Chebyshev: {
-					// T3: 4x^3 - 3x (generates 3rd harmonic)
-					float x = (float)sin(2 * PI * t);
-					samples[n] = 4.0f * x * x * x - 3.0f * x;
-					break;
-				}
-
-				// ===== TAB 9: VINTAGE SYNTH EMULATIONS =====
-				case WaveType::ARPOdyssey: {
-					// ARP Odyssey - raw, aggressive oscillators with wide range
-					float saw = 2.0f * (float)t - 1.0f;
-					float tri = 1.0f - 4.0f * std::abs((float)t - 0.5f);
-					// Blend saw and triangle with emphasis on odd harmonics
-					float blend = (saw * 0.7f + tri * 0.3f);
-					blend += 0.15f * (float)sin(6 * PI * t); // Odd harmonic emphasis
-					samples[n] = blend - 2.0f * PolyBLEP((float)t, dt);
-					break;
-				}
-
-				case WaveType::CS80: {
-					// Yamaha CS-80 - lush, warm, thick analog pads
-					float saw1 = 2.0f * (float)t - 1.0f;
-					float saw2 = 2.0f * fmodf((float)t * 1.003f, 1.0f) - 1.0f;
-					float saw3 = 2.0f * fmodf((float)t * 0.997f, 1.0f) - 1.0f;
-					float saw4 = 2.0f * fmodf((float)t * 1.001f, 1.0f) - 1.0f;
-					// Four detuned oscillators with subtle chorus
-					float lfo = (float)sin(2 * PI * 0.3f * t) * 0.002f;
-					float blend = (saw1 + saw2 + saw3 + saw4 * (1.0f + lfo)) / 4.0f;
-					// Add warmth with low-pass character
-					blend = blend * 0.85f + 0.15f * (float)sin(2 * PI * t);
-					samples[n] = blend - 2.0f * PolyBLEP((float)t, dt);
-					break;
-				}
+			WaveKernels::Get(type, context.precision)(samples.data(), params);
 
-				case WaveType::Juno: {
-					// Juno-style saw with chorus character
-					float saw1 = 2.0f * (float)t - 1.0f;
-					float saw2 = 2.0f * fmodf((float)t * 1.005f, 1.0f) - 1.0f;
-					float lfo = (float)sin(2 * PI * 0.5f * t) * 0.003f;
-					float chorus = 2.0f * fmodf((float)t * (1.0f + lfo), 1.0f) - 1.0f;
-					samples[n] = (saw1 * 0.5f + saw2 * 0.3f + chorus * 0.2f) - 2.0f * PolyBLEP((float)t, dt);
-					break;
-				}
-
-				case WaveType::MiniMoog: {
-					// Minimoog-style saw with slight detuning and warmth
-					float saw1 = 2.0f * (float)t - 1.0f;
-					float saw2 = 2.0f * fmodf((float)t * 1.002f, 1.0f) - 1.0f; // Slight detune
-					float saw3 = 2.0f * fmodf((float)t * 0.998f, 1.0f) - 1.0f;
-					float blend = (saw1 + saw2 * 0.7f + saw3 * 0.7f) / 2.4f;
-					samples[n] = blend - 2.0f * PolyBLEP((float)t, dt);
-					break;
-				}
-
-				case WaveType::MS20: {
-					// Korg MS-20 - aggressive, acidic, raw with distinctive filter
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					// Add resonant peak at different frequency than TB-303
-					value = value + 0.4f * (float)sin(10 * PI * t);
-					// Hard clipping for aggressive character
-					samples[n] = std::tanh(value * 1.5f);
-					break;
-				}
-
-				case WaveType::Oberheim: {
-					// Oberheim SEM style - rich multi-mode character
-					float saw = 2.0f * (float)t - 1.0f - 2.0f * PolyBLEP((float)t, dt);
-					float pulse = ((float)t < 0.5f ? 1.0f : -1.0f) - PolyBLEP((float)t, dt) + PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
-					samples[n] = (saw * 0.6f + pulse * 0.4f);
-					break;
-				}
-
-				case WaveType::PPG: {
-					// PPG Wave style - digital stepped waveshape
-					int steps = 64;
-					int step = (int)(t * steps) % steps;
-					float phase = (float)step / (float)steps;
-					samples[n] = (float)sin(2 * PI * phase) * 0.7f + (2.0f * phase - 1.0f) * 0.3f;
-					break;
-				}
-
-				case WaveType::Prophet5: {
-					// Prophet-5 style saw - smoother, less harsh
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					// Add slight warmth with 2nd harmonic
-					value = value * 0.8f + 0.2f * (float)sin(4 * PI * t);
-					samples[n] = value;
-					break;
-				}
-
-				case WaveType::TB303: {
-					// TB-303 style saw - bright and acidic
-					float value = 2.0f * (float)t - 1.0f;
-					value -= 2.0f * PolyBLEP((float)t, dt);
-					// Add resonant peak simulation
-					value = value + 0.3f * (float)sin(8 * PI * t);
-					samples[n] = std::tanh(value * 1.2f); // Slight saturation
-					break;
-				}
-
-				// ===== TAB 10: VOWEL FORMANTS =====
-				case WaveType::VowelA: {
-					// Vowel "A" (as in "father") - F1=730Hz, F2=1090Hz, F3=2440Hz
-					float f1 = (float)sin(2 * PI * 730.0 / 261.63 * t);
-					float f2 = (float)sin(2 * PI * 1090.0 / 261.63 * t) * 0.7f;
-					float f3 = (float)sin(2 * PI * 2440.0 / 261.63 * t) * 0.3f;
-					samples[n] = (f1 + f2 + f3) / 2.0f;
-					break;
-				}
-
-				case WaveType::VowelE: {
-					// Vowel "E" (as in "bed") - F1=530Hz, F2=1840Hz, F3=2480Hz
-					float f1 = (float)sin(2 * PI * 530.0 / 261.63 * t);
-					float f2 = (float)sin(2 * PI * 1840.0 / 261.63 * t) * 0.8f;
-					float f3 = (float)sin(2 * PI * 2480.0 / 261.63 * t) * 0.3f;
-					samples[n] = (f1 + f2 + f3) / 2.1f;
-					break;
-				}
-
-				case WaveType::VowelI: {
-					// Vowel "I" (as in "see") - F1=270Hz, F2=2290Hz, F3=3010Hz
-					float f1 = (float)sin(2 * PI * 270.0 / 261.63 * t);
-					float f2 = (float)sin(2 * PI * 2290.0 / 261.63 * t) * 0.9f;
-					float f3 = (float)sin(2 * PI * 3010.0 / 261.63 * t) * 0.4f;
-					samples[n] = (f1 + f2 + f3) / 2.3f;
-					break;
-				}
+			RemoveDCOffset(samples);
+			return samples;
+		}
 
-				case WaveType::VowelO: {
-					// Vowel "O" (as in "go") - F1=570Hz, F2=840Hz, F3=2410Hz
-					float f1 = (float)sin(2 * PI * 570.0 / 261.63 * t);
-					float f2 = (float)sin(2 * PI * 840.0 / 261.63 * t) * 0.7f;
-					float f3 = (float)sin(2 * PI * 2410.0 / 261.63 * t) * 0.2f;
-					samples[n] = (f1 + f2 + f3) / 1.9f;
-					break;
-				}
+		// Get a single waveform cycle from the cache, generating it on a miss
+		WaveCache::WaveBuffer WaveGenerator::GetCachedWave(WaveType type, size_t numSamples, const GenerationContext& context) {
+			// Randomized waves are keyed by their seed; deterministic ones are shared across seeds
+			uint64_t seed = WaveKernels::UsesSeed(type) ? context.WaveSeed(type) : 0;
+			WaveCacheKey key = { type, numSamples, context.pulseDuty, context.maxHarmonics, seed, context.precision };
+			return m_waveCache->GetOrCreate(key, [&]() {
+				return GenerateWave(type, numSamples, context);
+			});
+		}
 
-				case WaveType::VowelU: {
-					// Vowel "U" (as in "boot") - F1=300Hz, F2=870Hz, F3=2240Hz
-					float f1 = (float)sin(2 * PI * 300.0 / 261.63 * t);
-					float f2 = (float)sin(2 * PI * 870.0 / 261.63 * t) * 0.6f;
-					float f3 = (float)sin(2 * PI * 2240.0 / 261.63 * t) * 0.2f;
-					samples[n] = (f1 + f2 + f3) / 1.8f;
-					break;
-				}
+		// Remove DC offset (mean value) from a buffer
+		void WaveGenerator::RemoveDCOffset(std::vector<float>& samples) {
+			RemoveDCOffset(samples.data(), samples.size());
+		}
 
-				case WaveType::Diphthong: {
-					// Morphing vowel (A to I)
-					float morph = (float)sin(2 * PI * 0.25f * t) * 0.5f + 0.5f; // 0 to 1
-					float f1a = 730.0f, f1i = 270.0f;
-					float f2a = 1090.0f, f2i = 2290.0f;
-					float f1 = f1a + (f1i - f1a) * morph;
-					float f2 = f2a + (f2i - f2a) * morph;
-					float formant1 = (float)sin(2 * PI * f1 / 261.63 * t);
-					float formant2 = (float)sin(2 * PI * f2 / 261.63 * t) * 0.8f;
-					samples[n] = (formant1 + formant2) / 1.8f;
-					break;
-				}
-				}
-			}
+		void WaveGenerator::RemoveDCOffset(float* samples, size_t numSamples) {
+			if (numSamples == 0) return;
 
-			// Remove DC offset
 			float dcOffset = 0.0f;
-			for (float s : samples)
-				dcOffset += s;
+			for (size_t i = 0; i < numSamples; ++i)
+				dcOffset += samples[i];
 
 			dcOffset /= (float)numSamples;
 
-			for (float& s : samples)
-				s -= dcOffset;
-
-			return samples;
+			for (size_t i = 0; i < numSamples; ++i)
+				samples[i] -= dcOffset;
 		}
 
 		// Combine multiple waves with weights (bandlimited, NO normalization)
 		std::vector<float> WaveGenerator::CombineWaves(
 			const std::vector<std::pair<WaveType, float>>& waves,
-			size_t numSamples
+			size_t numSamples,
+			const GenerationContext& context
 		) {
 			std::vector<float> result(numSamples, 0.0f);
 
 			for (auto& w : waves) {
-				std::vector<float> samples = GenerateWave(w.first, numSamples, m_pulseDuty, m_maxHarmonics);
+				WaveCache::WaveBuffer wave = GetCachedWave(w.first, numSamples, context);
+				const std::vector<float>& samples = *wave;
 				float weight = w.second;
 				for (size_t i = 0; i < numSamples; ++i)
 					result[i] += samples[i] * weight;
 			}
 
-			// Remove DC offset
-			float dcOffset = 0.0f;
-			for (float s : result)
-				dcOffset += s;
-			dcOffset /= (float)numSamples;
-
-			for (float& s : result)
-				s -= dcOffset;
+			RemoveDCOffset(result);
 
 			// NOTE: No normalization here! Will be done globally for entire wavetable
 			return result;
@@ -878,54 +108,73 @@ namespace WavetableGen {
 			const WavetableFrame& startFrame,
 			const WavetableFrame& endFrame,
 			int numFrames,
-			MorphCurve morphCurve
+			MorphCurve morphCurve,
+			const GenerationContext& context
 		) {
-			std::vector<float> wavetable;
-			wavetable.reserve(numFrames * SAMPLES_PER_WAVE);
+			// Every frame blends the same basis cycles: the unique waveforms of both frames
+			std::vector<WaveType> basisTypes;
+			auto basisIndex = [&basisTypes](WaveType type) {
+				auto it = std::find(basisTypes.begin(), basisTypes.end(), type);
+				if (it != basisTypes.end())
+					return (size_t)(it - basisTypes.begin());
+				basisTypes.push_back(type);
+				return basisTypes.size() - 1;
+			};
+			for (const auto& startWave : startFrame.waveforms)
+				basisIndex(startWave.first);
+			for (const auto& endWave : endFrame.waveforms)
+				basisIndex(endWave.first);
+
+			const size_t numBasis = basisTypes.size();
+			const size_t frameCount = numFrames > 0 ? (size_t)numFrames : 0;
+
+			// Render each basis cycle once (W renders instead of F * W)
+			std::vector<float> basis(numBasis * SAMPLES_PER_WAVE);
+			for (size_t w = 0; w < numBasis; ++w) {
+				WaveCache::WaveBuffer wave = GetCachedWave(basisTypes[w], SAMPLES_PER_WAVE, context);
+				std::copy(wave->begin(), wave->end(), basis.begin() + w * SAMPLES_PER_WAVE);
+			}
 
-			for (int frame = 0; frame < numFrames; ++frame) {
+			// Weight matrix: one row per frame, one column per basis cycle
+			std::vector<float> weights(frameCount * numBasis, 0.0f);
+			for (size_t frame = 0; frame < frameCount; ++frame) {
 				float morphPositionLinear = (float)frame / (numFrames - 1);
 				float morphPosition = WaveformEffects::ApplyMorphCurve(morphPositionLinear, morphCurve);
-
-				std::vector<std::pair<WaveType, float>> frameWaves;
+				float* row = &weights[frame * numBasis];
 
 				for (const auto& startWave : startFrame.waveforms) {
 					float startWeight = startWave.second * (1.0f - morphPosition);
-					if (startWeight > 0.0f) {
-						frameWaves.push_back({ startWave.first, startWeight });
-					}
+					if (startWeight > 0.0f)
+						row[basisIndex(startWave.first)] += startWeight;
 				}
 
 				for (const auto& endWave : endFrame.waveforms) {
 					float endWeight = endWave.second * morphPosition;
-					if (endWeight > 0.0f) {
-						bool found = false;
-						for (auto& fw : frameWaves) {
-							if (fw.first == endWave.first) {
-								fw.second += endWeight;
-								found = true;
-								break;
-							}
-						}
-						if (!found) {
-							frameWaves.push_back({ endWave.first, endWeight });
-						}
-					}
+					if (endWeight > 0.0f)
+						row[basisIndex(endWave.first)] += endWeight;
 				}
-
-				auto frameSamples = CombineWaves(frameWaves, SAMPLES_PER_WAVE);
-				wavetable.insert(wavetable.end(), frameSamples.begin(), frameSamples.end());
 			}
 
+			// Matrix product over frame ranges in parallel, then per-frame DC removal as CombineWaves does
+			// Each range also records its frame peaks for the global normalization below
+			std::vector<float> wavetable(frameCount * SAMPLES_PER_WAVE);
+			std::vector<float> framePeaks(frameCount, 0.0f);
+			m_threadPool->ParallelFor(0, frameCount, RENDER_FRAMES_PER_TASK, [&](size_t first, size_t last) {
+				float* frames = &wavetable[first * SAMPLES_PER_WAVE];
+				MorphEngine::RenderFrames(&weights[first * numBasis], last - first, numBasis, basis.data(), SAMPLES_PER_WAVE, frames);
+				for (size_t frame = first; frame < last; ++frame) {
+					float* samples = &wavetable[frame * SAMPLES_PER_WAVE];
+					RemoveDCOffset(samples, SAMPLES_PER_WAVE);
+					framePeaks[frame] = PeakAbs(samples, SAMPLES_PER_WAVE);
+				}
+			});
+
 			// GLOBAL normalization across ALL frames to preserve relative amplitude relationships
 			float globalMaxVal = 0.0f;
-			for (float s : wavetable)
-				globalMaxVal = (std::max)(globalMaxVal, std::abs(s));
+			for (float peak : framePeaks)
+				globalMaxVal = (std::max)(globalMaxVal, peak);
 
-			if (globalMaxVal > 0.0f) {
-				for (float& s : wavetable)
-					s /= globalMaxVal;
-			}
+			ScaleFrames(wavetable, frameCount, globalMaxVal);
 
 			return wavetable;
 		}
@@ -941,13 +190,32 @@ namespace WavetableGen {
 			}
 		}
 
+		// Largest absolute sample of a buffer
+		float WaveGenerator::PeakAbs(const float* samples, size_t numSamples) {
+			float maxVal = 0.0f;
+			for (size_t i = 0; i < numSamples; ++i)
+				maxVal = (std::max)(maxVal, std::abs(samples[i]));
+			return maxVal;
+		}
+
+		// Divide every sample by peak (same per-sample division as NormalizeSamples), frames in parallel
+		void WaveGenerator::ScaleFrames(std::vector<float>& frames, size_t numFrames, float peak) {
+			if (peak <= 0.0f) return;
+
+			const size_t frameSize = numFrames > 0 ? frames.size() / numFrames : 0;
+			m_threadPool->ParallelFor(0, numFrames, RENDER_FRAMES_PER_TASK, [&](size_t first, size_t last) {
+				for (size_t i = first * frameSize; i < last * frameSize; ++i)
+					frames[i] /= peak;
+			});
+		}
+
 		// Generate audio preview (multi-second looped sample with fades)
 		std::vector<float> WaveGenerator::GenerateAudioPreview(const std::vector<std::pair<WaveType, float>>& startWaves,
-			const EffectsSettings& effects) {
-			auto singleCycle = CombineWaves(startWaves, SAMPLES_PER_WAVE);
+			const EffectsSettings& effects, const GenerationContext& context) {
+			auto singleCycle = CombineWaves(startWaves, SAMPLES_PER_WAVE, context);
 
 			// Apply effects to single cycle
-			WaveformEffects::ApplyEffects(singleCycle, effects);
+			WaveformEffects::ApplyEffects(singleCycle, effects, context.FrameSeed(0));
 
 			NormalizeSamples(singleCycle);
 
@@ -1007,35 +275,56 @@ namespace WavetableGen {
 		// Generate morphing wavetable
 		std::vector<float> WaveGenerator::GenerateMorphingWavetable(const std::vector<std::pair<WaveType, float>>& startWaves,
 			const std::vector<std::pair<WaveType, float>>& endWaves, int numFrames, const EffectsSettings& effects,
-			MorphCurve morphCurve) {
+			MorphCurve morphCurve, const GenerationContext& context) {
 			WavetableFrame startFrame;
 			startFrame.waveforms = startWaves;
 
 			WavetableFrame endFrame = CreateEndFrame(startWaves, endWaves);
 
-			std::vector<float> wavetable = GenerateMultiFrameWavetable(startFrame, endFrame, numFrames, morphCurve);
-
-			// Apply effects to each frame
-			for (int frame = 0; frame < numFrames; ++frame) {
-				std::vector<float> frameSamples(wavetable.begin() + frame * SAMPLES_PER_WAVE,
-					wavetable.begin() + (frame + 1) * SAMPLES_PER_WAVE);
-				WaveformEffects::ApplyEffects(frameSamples, effects);
-				std::copy(frameSamples.begin(), frameSamples.end(), wavetable.begin() + frame * SAMPLES_PER_WAVE);
-			}
+			std::vector<float> wavetable = GenerateMultiFrameWavetable(startFrame, endFrame, numFrames, morphCurve, context);
+
+			// Apply effects to each frame in parallel (frames are independent until normalization,
+			// and each frame draws from its own seed, so the result does not depend on scheduling)
+			// The frames are split into one contiguous range per thread, each with its own compiled
+			// chain, so the effects allocate once per range rather than per frame, and the filters
+			// can process the range's frames side by side in SIMD lanes
+			const size_t frameCount = numFrames > 0 ? (size_t)numFrames : 0;
+			const size_t numRanges = (std::min)(frameCount, m_threadPool->GetConcurrency());
+			std::vector<float> framePeaks(frameCount, 0.0f);
+			m_threadPool->ParallelFor(0, numRanges, 1, [&](size_t firstRange, size_t lastRange) {
+				EffectChain chain(effects, SAMPLES_PER_WAVE);
+				std::vector<uint64_t> seeds;
+				for (size_t range = firstRange; range < lastRange; ++range) {
+					const size_t firstFrame = range * frameCount / numRanges;
+					const size_t lastFrame = (range + 1) * frameCount / numRanges;
+
+					seeds.clear();
+					for (size_t frame = firstFrame; frame < lastFrame; ++frame)
+						seeds.push_back(context.FrameSeed((int)frame));
+
+					chain.ProcessFrames(&wavetable[firstFrame * SAMPLES_PER_WAVE], lastFrame - firstFrame, seeds.data());
+					for (size_t frame = firstFrame; frame < lastFrame; ++frame)
+						framePeaks[frame] = PeakAbs(&wavetable[frame * SAMPLES_PER_WAVE], SAMPLES_PER_WAVE);
+				}
+			});
+
+			// Re-normalize globally after effects (peak reduced from the per-frame peaks)
+			float globalMaxVal = 0.0f;
+			for (float peak : framePeaks)
+				globalMaxVal = (std::max)(globalMaxVal, peak);
 
-			// Re-normalize globally after effects
-			NormalizeSamples(wavetable);
+			ScaleFrames(wavetable, frameCount, globalMaxVal);
 
 			return wavetable;
 		}
 
 		// Generate single-frame wavetable
 		std::vector<float> WaveGenerator::GenerateSingleFrameWavetable(const std::vector<std::pair<WaveType, float>>& startWaves,
-			const EffectsSettings& effects) {
-			std::vector<float> combined = CombineWaves(startWaves, SAMPLES_PER_WAVE);
+			const EffectsSettings& effects, const GenerationContext& context) {
+			std::vector<float> combined = CombineWaves(startWaves, SAMPLES_PER_WAVE, context);
 
 			// Apply effects
-			WaveformEffects::ApplyEffects(combined, effects);
+			WaveformEffects::ApplyEffects(combined, effects, context.FrameSeed(0));
 
 			NormalizeSamples(combined);
 			return combined;
@@ -1053,33 +342,36 @@ namespace WavetableGen {
 			const EffectsSettings& effects,
 			MorphCurve morphCurve,
 			double pulseDuty,
-			int maxHarmonics
+			int maxHarmonics,
+			uint64_t seed,
+			GenerationPrecision precision
 		) {
 			if (startWaves.empty()) {
 				return GenerationResult::ErrorEmptyWaveforms;
 			}
 
-			// Store pulse duty cycle for PWM waves
-			m_pulseDuty = pulseDuty;
-
-			// Store max harmonics for harmonic waveforms
-			m_maxHarmonics = maxHarmonics;
+			// All per-call state travels in the context (nothing is stored on the generator)
+			GenerationContext context;
+			context.pulseDuty = pulseDuty;
+			context.maxHarmonics = maxHarmonics;
+			context.seed = seed;
+			context.precision = precision;
 
 			std::vector<float> samples;
 
 			// Generate audio preview (always writes WAV format)
 			if (isAudioPreview) {
-				samples = GenerateAudioPreview(startWaves, effects);
+				samples = GenerateAudioPreview(startWaves, effects, context);
 				auto writer = FileWriterFactory::Create(OutputFormat::WAV);
 				return writer->Write(filename, samples, 1, SAMPLE_RATE);
 			}
 
 			// Generate wavetable data
 			if (enableMorphing) {
-				samples = GenerateMorphingWavetable(startWaves, endWaves, numFrames, effects, morphCurve);
+				samples = GenerateMorphingWavetable(startWaves, endWaves, numFrames, effects, morphCurve, context);
 			}
 			else {
-				samples = GenerateSingleFrameWavetable(startWaves, effects);
+				samples = GenerateSingleFrameWavetable(startWaves, effects, context);
 				numFrames = 1;
 			}
 
@@ -1169,6 +461,11 @@ namespace WavetableGen {
 				int cutoff = static_cast<int>(effects.highPassCutoff * 100.0f + 0.5f);
 				filename << "_HP" << cutoff;
 			}
+			if ((effects.enableLowPass || effects.enableHighPass) && effects.filterType != FilterType::OnePole) {
+				filename << (effects.filterType == FilterType::Biquad ? "_Biquad" : "_SVF");
+				int resonance = static_cast<int>(effects.filterResonance * 100.0f + 0.5f);
+				filename << "Q" << resonance;
+			}
 
 			// Bit crushing
 			if (effects.enableBitCrush && effects.bitDepth < 16) {
@@ -1181,6 +478,22 @@ namespace WavetableGen {
 				filename << "_WF" << wfAmount;
 			}
 
+			// Anti-aliasing mode of the nonlinear effects (only if not polyphase oversampled)
+			bool shaped = (effects.distortionType != DistortionType::None && effects.distortionAmount > 0.0f) ||
+				(effects.enableWavefold && effects.wavefoldAmount > 0.0f);
+			bool resampled = shaped || (effects.enableBitCrush && effects.bitDepth < 16) ||
+				(effects.enableSampleRateReduction && effects.sampleRateReductionFactor > 1);
+			if (effects.antiAliasing == AntiAliasing::PeriodicOversampling && resampled) {
+				filename << "_PeriodicOS";
+			}
+			else if (shaped && (effects.antiAliasing == AntiAliasing::ADAA1 || effects.antiAliasing == AntiAliasing::ADAA2)) {
+				filename << (effects.antiAliasing == AntiAliasing::ADAA1 ? "_ADAA1" : "_ADAA2");
+			}
+			if (resampled && effects.oversamplingQuality != OversamplingQuality::Standard) {
+				static const char* const QUALITY_SUFFIXES[] = { "_OSDraft", "", "_OSHigh", "_OSMax" };
+				filename << QUALITY_SUFFIXES[static_cast<int>(effects.oversamplingQuality)];
+			}
+
 			// Symmetry operations
 			if (effects.mirrorHorizontal) {
 				filename << "_MirrorH";
@@ -1254,8 +567,8 @@ namespace WavetableGen {
 			// Calculate correlation for each waveform type
 			std::vector<std::pair<WaveType, float>> correlations;
 			for (WaveType type : allWaveTypes) {
-				// Generate reference waveform (using default harmonics=8 for analysis)
-				std::vector<float> refWave = GenerateWave(type, SAMPLES_PER_WAVE, 0.5, 8);
+				// Generate reference waveform (using the default context: duty 0.5, harmonics 8, default seed)
+				std::vector<float> refWave = *GetCachedWave(type, SAMPLES_PER_WAVE, GenerationContext());
 
 				// Normalize reference wave
 				float refMaxAbs = 0.0f;
@@ -1351,13 +664,6 @@ namespace WavetableGen {
 				}
 			}
 
-			// Get magnitude spectrum of imported frame
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(SAMPLES_PER_WAVE);
-
-			std::vector<DSP::FrequencyBin> importedSpectrum;
-			fftProcessor->Forward(normalizedFrame, importedSpectrum);
-
 			// List of all waveform types to test
 			std::vector<WaveType> allWaveTypes = {
 				WaveType::Sine, WaveType::Square, WaveType::Triangle, WaveType::Saw,
@@ -1373,35 +679,47 @@ namespace WavetableGen {
 				WaveType::Stepped, WaveType::Noise, WaveType::Procedural
 			};
 
-			// Calculate spectral distance for each waveform type
-			std::vector<std::pair<WaveType, float>> spectralMatches;
-
-			for (WaveType type : allWaveTypes) {
-				// Generate reference waveform
-				std::vector<float> refWave = GenerateWave(type, SAMPLES_PER_WAVE, 0.5, 8);
+			// The imported frame, then every normalized reference waveform, as contiguous frames
+			const size_t numFrames = allWaveTypes.size() + 1;
+			std::vector<float> frames(numFrames * SAMPLES_PER_WAVE);
+			std::copy(normalizedFrame.begin(), normalizedFrame.end(), frames.begin());
+			for (size_t t = 0; t < allWaveTypes.size(); ++t) {
+				WaveCache::WaveBuffer refWave = GetCachedWave(allWaveTypes[t], SAMPLES_PER_WAVE, GenerationContext());
+				float* frame = &frames[(t + 1) * SAMPLES_PER_WAVE];
+				std::copy(refWave->begin(), refWave->end(), frame);
 
 				// Normalize reference wave
-				float refMaxAbs = 0.0f;
-				for (float sample : refWave) {
-					refMaxAbs = std::max(refMaxAbs, std::abs(sample));
-				}
+				float refMaxAbs = PeakAbs(frame, SAMPLES_PER_WAVE);
 				if (refMaxAbs > 0.0f) {
-					for (float& sample : refWave) {
-						sample /= refMaxAbs;
+					for (size_t i = 0; i < SAMPLES_PER_WAVE; ++i) {
+						frame[i] /= refMaxAbs;
 					}
 				}
+			}
+
+			// All spectra with one batched transform (one FFT plan per thread)
+			// Only magnitudes are compared, so the complex spectrum is enough (no atan2 per bin)
+			thread_local std::unique_ptr<DSP::IFrequencyProcessor> fftProcessor =
+				DSP::FrequencyProcessorFactory::Create(SAMPLES_PER_WAVE);
+			const size_t numBins = SAMPLES_PER_WAVE / 2 + 1;
+			std::vector<DSP::ComplexBin> spectra(numFrames * numBins);
+			fftProcessor->ForwardBatch(frames.data(), spectra.data(), numFrames);
+			const DSP::ComplexBin* importedSpectrum = spectra.data();
+
+			// Calculate spectral distance for each waveform type
+			std::vector<std::pair<WaveType, float>> spectralMatches;
 
-				// Get magnitude spectrum of reference
-				std::vector<DSP::FrequencyBin> refSpectrum;
-				fftProcessor->Forward(refWave, refSpectrum);
+			for (size_t t = 0; t < allWaveTypes.size(); ++t) {
+				WaveType type = allWaveTypes[t];
+				const DSP::ComplexBin* refSpectrum = spectra.data() + (t + 1) * numBins;
 
 				// Calculate spectral distance (Euclidean distance of magnitude spectra)
 				// Focus on lower bins (more perceptually relevant)
 				float distance = 0.0f;
-				int numBinsToCompare = std::min((int)importedSpectrum.size(), 512); // Compare first 512 bins
+				int numBinsToCompare = std::min((int)numBins, 512); // Compare first 512 bins
 
 				for (int i = 1; i < numBinsToCompare; ++i) { // Skip DC component
-					float diff = importedSpectrum[i].magnitude - refSpectrum[i].magnitude;
+					float diff = std::abs(importedSpectrum[i]) - std::abs(refSpectrum[i]);
 					distance += diff * diff;
 
 					// Weight lower frequencies more heavily (more perceptually important)
@@ -4,9 +4,14 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <memory>
 #include "IWavetableGenerator.h"
 #include "WaveType.h"
+#include "WaveCache.h"
+#include "GenerationContext.h"
 #include "../DSP/WaveformEffects.h"
+#include "../DSP/IFrequencyProcessor.h"
+#include "../Utils/ThreadPool.h"
 
 namespace WavetableGen {
 	namespace Core {
@@ -34,12 +39,23 @@ namespace WavetableGen {
 			std::vector<std::pair<WaveType, float>> waveforms; // Waveform types and their weights
 		};
 
+		// Generation state lives in a GenerationContext passed down each call, so one instance per
+		// thread can generate concurrently (the wave cache may be shared between instances)
 		class WaveGenerator : public IWavetableGenerator {
 		public:
 			WaveGenerator() = default;
 			~WaveGenerator() = default;
 
+			// Share a basis-wave cache with other generators (e.g. batch workers)
+			// threadPool: runs the per-frame work (nullptr = ThreadPool::GetShared())
+			explicit WaveGenerator(std::shared_ptr<WaveCache> waveCache, Utils::ThreadPool* threadPool = nullptr);
+
+			// Cache of generated basis cycles (shared with the analyzers and batch generation)
+			const std::shared_ptr<WaveCache>& GetWaveCache() const { return m_waveCache; }
+
 			// Main public API: Generate a wavetable with the specified parameters
+			// seed: drives every randomized waveform and effect (same seed, same file)
+			// precision: Fast trades a small, bounded error per wave type for speed (bulk batches)
 			GenerationResult GenerateWavetable(
 				const std::vector<std::pair<WaveType, float>>& startWaves,
 				const std::vector<std::pair<WaveType, float>>& endWaves,
@@ -51,7 +67,9 @@ namespace WavetableGen {
 				const EffectsSettings& effects = EffectsSettings(),
 				MorphCurve morphCurve = MorphCurve::Linear,
 				double pulseDuty = 0.5,
-				int maxHarmonics = 8);
+				int maxHarmonics = 8,
+				uint64_t seed = DEFAULT_GENERATION_SEED,
+				GenerationPrecision precision = GenerationPrecision::Exact) override;
 
 			// Generate filename from waveform settings (used by WinApplication)
 			std::string GenerateFilenameFromSettings(
@@ -68,41 +86,58 @@ namespace WavetableGen {
 			// Analyze an imported frame using spectral matching (frequency-domain)
 			std::vector<std::pair<WaveType, float>> AnalyzeFrameSpectral(const std::vector<float>& frameData) override;
 
+			// New generator sharing this one's wave cache and thread pool
+			std::unique_ptr<IWavetableGenerator> Clone() const override;
+
 		private:
 			// Generate a single waveform cycle
-			std::vector<float> GenerateWave(WaveType type, size_t numSamples, double pulseDuty = 0.5, int maxHarmonics = 8);
+			std::vector<float> GenerateWave(WaveType type, size_t numSamples, const GenerationContext& context);
+
+			// Get a single waveform cycle from the cache, generating it on a miss
+			WaveCache::WaveBuffer GetCachedWave(WaveType type, size_t numSamples, const GenerationContext& context);
 
-			// PolyBLEP (Polynomial Band-Limited Step) for anti-aliasing
-			static float PolyBLEP(float t, float dt);
+			// Remove DC offset (mean value) from a buffer
+			static void RemoveDCOffset(std::vector<float>& samples);
+			static void RemoveDCOffset(float* samples, size_t numSamples);
 
 			// Combine multiple waves with weights
-			std::vector<float> CombineWaves(const std::vector<std::pair<WaveType, float>>& waves, size_t numSamples);
+			std::vector<float> CombineWaves(const std::vector<std::pair<WaveType, float>>& waves, size_t numSamples,
+				const GenerationContext& context);
 
 			// Generate a multi-frame wavetable with morphing
 			std::vector<float> GenerateMultiFrameWavetable(const WavetableFrame& startFrame, const WavetableFrame& endFrame,
-				int numFrames, MorphCurve morphCurve = MorphCurve::Linear);
+				int numFrames, MorphCurve morphCurve, const GenerationContext& context);
 
 			// Helper methods for GenerateWavetable
 			std::vector<float> GenerateAudioPreview(const std::vector<std::pair<WaveType, float>>& startWaves,
-				const EffectsSettings& effects);
+				const EffectsSettings& effects, const GenerationContext& context);
 
 			std::vector<float> GenerateMorphingWavetable(const std::vector<std::pair<WaveType, float>>& startWaves,
 				const std::vector<std::pair<WaveType, float>>& endWaves, int numFrames, const EffectsSettings& effects,
-				MorphCurve morphCurve);
+				MorphCurve morphCurve, const GenerationContext& context);
 
 			std::vector<float> GenerateSingleFrameWavetable(const std::vector<std::pair<WaveType, float>>& startWaves,
-				const EffectsSettings& effects);
+				const EffectsSettings& effects, const GenerationContext& context);
 
 			void NormalizeSamples(std::vector<float>& samples);
 
+			// Largest absolute sample of a buffer
+			static float PeakAbs(const float* samples, size_t numSamples);
+
+			// Divide every sample of a multi-frame buffer by peak, frames in parallel
+			void ScaleFrames(std::vector<float>& frames, size_t numFrames, float peak);
+
 			WavetableFrame CreateEndFrame(const std::vector<std::pair<WaveType, float>>& startWaves,
 				const std::vector<std::pair<WaveType, float>>& endWaves);
 
-			// Store pulse duty cycle for PWM
-			double m_pulseDuty = 0.5;
+			// Memoized basis cycles
+			std::shared_ptr<WaveCache> m_waveCache = std::make_shared<WaveCache>();
+
+			// Frames of one wavetable are rendered and processed in parallel on this pool
+			Utils::ThreadPool* m_threadPool = &Utils::ThreadPool::GetShared();
 
-			// Store max harmonics for harmonic waveforms
-			int m_maxHarmonics = 8;
+			// Inverse FFT for spectral additive synthesis (created on first use, resized per cycle length)
+			std::unique_ptr<DSP::IFrequencyProcessor> m_additiveFFT;
 		};
 	} // namespace Core
 } // namespace WavetableGen
@@ -0,0 +1,990 @@
+#include "WaveKernels.h"
+#include "BasicWaveKernels.h"
+#include "FastWaveKernels.h"
+#include "WaveGenerator.h"
+#include "ChaosEngine.h"
+#include "HarmonicSpectrum.h"
+#include "../Utils/XorShift128Plus.h"
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			// Normalized phase (0.0 to 1.0) of sample n
+			inline double Phase(size_t n, size_t numSamples) {
+				return (double)n / numSamples;
+			}
+
+			// Clear the output buffer before accumulating partials into it
+			inline void Clear(float* output, size_t numSamples) {
+				for (size_t n = 0; n < numSamples; ++n)
+					output[n] = 0.0f;
+			}
+
+			// Accumulate one sine partial: output += sin(2*PI*ratio*t) / divisor
+			inline void AddPartial(float* output, size_t numSamples, double ratio, float divisor) {
+				double w = 2 * PI * ratio;
+				for (size_t n = 0; n < numSamples; ++n) {
+					double t = Phase(n, numSamples);
+					output[n] += (float)sin(w * t) / divisor;
+				}
+			}
+
+			// True if the integer-harmonic kernels can use the inverse-FFT path
+			inline bool CanRenderSpectrally(const WaveKernelParams& p) {
+				return p.frequencyProcessor && HarmonicSpectrum::Supports(p.numSamples);
+			}
+
+			// Sum of integer-harmonic partials, output = sum(sin(2*PI*harmonic*t) / divisor)
+			// forEachPartial(add) calls add(harmonic, divisor) once per partial; the partials are
+			// rendered with one inverse FFT when possible, otherwise one sin() pass per partial
+			template <class PartialList>
+			void RenderHarmonicPartials(float* output, const WaveKernelParams& p, PartialList forEachPartial) {
+				if (CanRenderSpectrally(p)) {
+					HarmonicSpectrum spectrum(p.numSamples);
+					forEachPartial([&](int harmonic, float divisor) {
+						spectrum.AddPartial(harmonic, 1.0 / divisor);
+					});
+					spectrum.Render(*p.frequencyProcessor, output);
+					return;
+				}
+
+				Clear(output, p.numSamples);
+				forEachPartial([&](int harmonic, float divisor) {
+					AddPartial(output, p.numSamples, harmonic, divisor);
+				});
+			}
+
+			// ===== TAB 0: BASIC WAVES =====
+
+			void RenderSine(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					output[n] = (float)sin(2 * PI * t);
+				}
+			}
+
+			void RenderSquare(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = (float)t < 0.5f ? 1.0f : -1.0f;
+					value -= WaveKernels::PolyBLEP((float)t, dt);
+					value += WaveKernels::PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderTriangle(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 1.0f - 4.0f * std::abs((float)t - 0.5f);
+					value += dt * WaveKernels::PolyBLEP((float)t, dt);
+					value -= dt * WaveKernels::PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderSaw(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderReverseSaw(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 1.0f - 2.0f * (float)t;
+					value += 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderPulse(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				double pulseDuty = p.pulseDuty;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = (float)t < pulseDuty ? 1.0f : -1.0f;
+					value -= WaveKernels::PolyBLEP((float)t, dt);
+					value += WaveKernels::PolyBLEP(fmodf((float)t - (float)pulseDuty + 1.0f, 1.0f), dt);
+					output[n] = value;
+				}
+			}
+
+			// ===== TAB 1: CHAOS THEORY =====
+
+			void RenderLorenz(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderLorenz(output, p.numSamples);
+			}
+
+			void RenderRossler(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderRossler(output, p.numSamples);
+			}
+
+			void RenderHenon(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderHenon(output, p.numSamples);
+			}
+
+			void RenderDuffing(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderDuffing(output, p.numSamples);
+			}
+
+			void RenderChua(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderChua(output, p.numSamples);
+			}
+
+			void RenderLogisticChaos(float* output, const WaveKernelParams& p) {
+				ChaosEngine::RenderLogisticChaos(output, p.numSamples);
+			}
+
+			// ===== TAB 2: FRACTALS =====
+
+			void RenderWeierstrass(float* output, const WaveKernelParams& p) {
+				// Weierstrass function: sum of cos(b^n * pi * x) * a^n
+				// a controls smoothness (0 < a < 1), b must be odd integer
+				const float a = 0.5f; // Smoothness parameter
+				const int b = 7;      // Frequency multiplier (odd)
+				const int iterations = 8;
+
+				Clear(output, p.numSamples);
+
+				float a_n = 1.0f;
+				int b_n = 1;
+				for (int k = 0; k < iterations; ++k) {
+					double w = b_n * PI;
+					for (size_t n = 0; n < p.numSamples; ++n) {
+						double t = Phase(n, p.numSamples);
+						output[n] += a_n * (float)cos(w * t);
+					}
+					a_n *= a;
+					b_n *= b;
+				}
+			}
+
+			void RenderCantor(float* output, const WaveKernelParams& p) {
+				// Cantor (Devil's Staircase) function
+				const int iterations = 6;
+				float powers[iterations];
+				for (int k = 0; k < iterations; ++k)
+					powers[k] = (float)pow(3.0, k);
+
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float cantorVal = 0.0f;
+					float tScaled = fmodf((float)t, 1.0f);
+
+					for (int k = 0; k < iterations; ++k) {
+						float power = powers[k];
+						float segment = fmodf(tScaled * power, 1.0f);
+
+						if (segment < 0.333f) {
+							cantorVal += 0.0f / power;
+						}
+						else if (segment > 0.666f) {
+							cantorVal += 1.0f / power;
+						}
+						else {
+							cantorVal += 0.5f / power;
+						}
+					}
+					output[n] = (cantorVal - 0.5f) * 2.0f; // Center around zero
+				}
+			}
+
+			void RenderKoch(float* output, const WaveKernelParams& p) {
+				// Koch curve projection - creates crystalline patterns
+				const int iterations = 5;
+				float freqs[iterations];
+				for (int k = 1; k <= iterations; ++k)
+					freqs[k - 1] = (float)pow(4.0, k - 1);
+
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float kochVal = 0.0f;
+
+					for (int k = 0; k < iterations; ++k) {
+						float freq = freqs[k];
+						float amp = 1.0f / freq;
+						// Create angular, fractal pattern
+						float phase = fmodf((float)t * freq, 1.0f);
+						if (phase < 0.25f) {
+							kochVal += amp * (phase * 4.0f);
+						}
+						else if (phase < 0.5f) {
+							kochVal += amp * (2.0f - phase * 4.0f);
+						}
+						else if (phase < 0.75f) {
+							kochVal += amp * ((phase - 0.5f) * 4.0f);
+						}
+						else {
+							kochVal += amp * (1.0f - (phase - 0.75f) * 4.0f);
+						}
+					}
+					output[n] = (kochVal - 0.5f) * 2.0f;
+				}
+			}
+
+			void RenderMandelbrot(float* output, const WaveKernelParams& p) {
+				// Sample from Mandelbrot set boundary
+				const int maxIterations = 20;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					// Map waveform position to complex plane
+					float cReal = -0.7f + (float)t * 0.6f; // Scan interesting region
+					float cImag = 0.0f;
+
+					float zReal = 0.0f;
+					float zImag = 0.0f;
+					int iteration = 0;
+
+					// Mandelbrot iteration: z = z^2 + c
+					while (iteration < maxIterations && (zReal * zReal + zImag * zImag) < 4.0f) {
+						float zRealNew = zReal * zReal - zImag * zImag + cReal;
+						float zImagNew = 2.0f * zReal * zImag + cImag;
+						zReal = zRealNew;
+						zImag = zImagNew;
+						iteration++;
+					}
+
+					// Use iteration count to create waveform
+					float mandelbrotVal = (float)iteration / (float)maxIterations;
+					output[n] = (mandelbrotVal - 0.5f) * 2.0f;
+				}
+			}
+
+			// ===== TAB 3: HARMONIC WAVES =====
+
+			void RenderOddHarmonics(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 1; k <= p.maxHarmonics * 2 - 1; k += 2)
+						add(k, (float)k);
+				});
+			}
+
+			void RenderEvenHarmonics(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 2; k <= p.maxHarmonics; k += 2)
+						add(k, (float)k);
+				});
+			}
+
+			void RenderHarmonicSeries(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 1; k <= p.maxHarmonics; ++k)
+						add(k, (float)k);
+				});
+			}
+
+			void RenderSubHarmonics(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = (float)sin(2 * PI * t);
+					val += 0.5f * (float)sin(2 * PI * t + PI / 2.0);
+					val += 0.25f * (float)sin(2 * PI * t + PI);
+					output[n] = val;
+				}
+			}
+
+			void RenderFormant(float* output, const WaveKernelParams& p) {
+				// Bandlimited vocal formants
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = 0.0f;
+					val += (float)sin(2 * PI * 2 * t);
+					val += (float)sin(2 * PI * 3 * t) * 0.7f;
+					output[n] = val;
+				}
+			}
+
+			void RenderAdditive(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 1; k <= p.maxHarmonics; ++k)
+						add(k, (float)k);
+				});
+			}
+
+			// ===== TAB 4: INHARMONIC SERIES =====
+
+			void RenderStretchedHarm(float* output, const WaveKernelParams& p) {
+				// Harmonics stretched wider than natural
+				Clear(output, p.numSamples);
+				for (int k = 1; k <= p.maxHarmonics; ++k) {
+					float stretch = WaveKernels::PartialRatio(WaveType::StretchedHarm, k);
+					AddPartial(output, p.numSamples, stretch, (float)k);
+				}
+			}
+
+			void RenderCompressedHarm(float* output, const WaveKernelParams& p) {
+				// Harmonics compressed closer together
+				Clear(output, p.numSamples);
+				for (int k = 1; k <= p.maxHarmonics; ++k) {
+					float compress = WaveKernels::PartialRatio(WaveType::CompressedHarm, k);
+					AddPartial(output, p.numSamples, compress, (float)k);
+				}
+			}
+
+			void RenderMetallic(float* output, const WaveKernelParams& p) {
+				// Bell-like inharmonic overtones
+				const double w1 = 2 * PI * 2.76f, w2 = 2 * PI * 5.40f, w3 = 2 * PI * 8.93f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = (float)sin(2 * PI * t); // Fundamental
+					val += 0.5f * (float)sin(w1 * t); // Inharmonic partial
+					val += 0.3f * (float)sin(w2 * t);
+					val += 0.2f * (float)sin(w3 * t);
+					output[n] = val / 2.0f;
+				}
+			}
+
+			void RenderClangorous(float* output, const WaveKernelParams& p) {
+				// Gong/cymbal-like inharmonic spectrum
+				const double w1 = 2 * PI * 1.593f, w2 = 2 * PI * 2.136f;
+				const double w3 = 2 * PI * 2.653f, w4 = 2 * PI * 3.593f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = (float)sin(2 * PI * t);
+					val += 0.6f * (float)sin(w1 * t);
+					val += 0.4f * (float)sin(w2 * t);
+					val += 0.3f * (float)sin(w3 * t);
+					val += 0.2f * (float)sin(w4 * t);
+					output[n] = val / 2.5f;
+				}
+			}
+
+			void RenderKarplusStrong(float* output, const WaveKernelParams& p) {
+				// Karplus-Strong plucked string algorithm
+				const int delayLength = 50; // Short delay for higher pitch
+
+				// Initialize with noise burst (seeded, so the same seed always plucks the same string)
+				Utils::XorShift128Plus rng = Utils::XorShift128Plus::FromSeed(p.seed);
+				float delayLine[delayLength];
+				for (int i = 0; i < delayLength; ++i) {
+					delayLine[i] = rng.NextFloat(-1.0f, 1.0f);
+				}
+
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					// Karplus-Strong averaging filter
+					float out = delayLine[n % delayLength];
+					float next = (out + delayLine[(n + 1) % delayLength]) * 0.5f * 0.996f; // Damping
+					delayLine[n % delayLength] = next;
+					output[n] = out;
+				}
+			}
+
+			void RenderStiffString(float* output, const WaveKernelParams& p) {
+				// Piano-like inharmonicity (f_n = n * f0 * sqrt(1 + B*n^2))
+				Clear(output, p.numSamples);
+				for (int k = 1; k <= p.maxHarmonics; ++k) {
+					float freq = WaveKernels::PartialRatio(WaveType::StiffString, k);
+					AddPartial(output, p.numSamples, freq, (float)k);
+				}
+			}
+
+			// ===== TAB 5: MODERN/DIGITAL + MATHEMATICAL =====
+
+			void RenderSupersaw(float* output, const WaveKernelParams& p) {
+				// Bandlimited supersaw
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					value += 0.2f * (float)sin(2 * PI * 2 * t);
+					value += 0.1f * (float)sin(2 * PI * 3 * t);
+					output[n] = value;
+				}
+			}
+
+			void RenderPWMSaw(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				const double duty = 0.25;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = (float)t < duty ? 1.0f : -1.0f;
+					value -= WaveKernels::PolyBLEP((float)t, dt);
+					value += WaveKernels::PolyBLEP(fmodf((float)t - (float)duty + 1.0f, 1.0f), dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderParabolic(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					output[n] = 1.0f - 4.0f * (float)((t - 0.5) * (t - 0.5));
+				}
+			}
+
+			void RenderDoubleSine(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					output[n] = (float)sin(2 * PI * t) * (float)cos(2 * PI * t);
+				}
+			}
+
+			void RenderHalfSine(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					output[n] = (float)std::abs(sin(2 * PI * t)) * 2.0f - 1.0f;
+				}
+			}
+
+			void RenderTrapezoid(float* output, const WaveKernelParams& p) {
+				float dt = 1.0f / (float)p.numSamples;
+				const float slope = 0.2f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value;
+					if (t < slope)
+						value = (float)t / slope * 2.0f - 1.0f;
+					else if (t < 0.5f)
+						value = 1.0f;
+					else if (t < 0.5f + slope)
+						value = 1.0f - ((float)t - 0.5f) / slope * 2.0f;
+					else
+						value = -1.0f;
+					value += dt * WaveKernels::PolyBLEP((float)t, dt);
+					value -= dt * WaveKernels::PolyBLEP(fmodf((float)t - slope, 1.0f), dt);
+					value -= dt * WaveKernels::PolyBLEP(fmodf((float)t - 0.5f, 1.0f), dt);
+					value += dt * WaveKernels::PolyBLEP(fmodf((float)t - 0.5f - slope, 1.0f), dt);
+					output[n] = value;
+				}
+			}
+
+			void RenderPower(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float phase = (float)t * 2.0f;
+					if (phase < 1.0f) {
+						output[n] = std::pow(phase, 1.5f) * 2.0f - 1.0f;
+					}
+					else {
+						output[n] = 1.0f - std::pow(phase - 1.0f, 1.5f) * 2.0f;
+					}
+				}
+			}
+
+			void RenderExponential(float* output, const WaveKernelParams& p) {
+				const float range = std::exp(1.0f) - 1.0f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float phase = (float)t * 2.0f;
+					if (phase < 1.0f) {
+						output[n] = 2.0f * (std::exp(phase) - 1.0f) / range - 1.0f;
+					}
+					else {
+						float x = phase - 1.0f;
+						output[n] = 1.0f - 2.0f * (std::exp(x) - 1.0f) / range;
+					}
+				}
+			}
+
+			void RenderLogistic(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float phase = (float)t * 2.0f;
+					if (phase < 1.0f) {
+						float x = phase * 12.0f - 6.0f;
+						float logistic = 1.0f / (1.0f + std::exp(-x));
+						output[n] = (logistic - 0.5f) * 2.0f;
+					}
+					else {
+						float x = (phase - 1.0f) * 12.0f - 6.0f;
+						float logistic = 1.0f / (1.0f + std::exp(-x));
+						output[n] = (0.5f - logistic) * 2.0f;
+					}
+				}
+			}
+
+			void RenderStepped(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					int step = (int)(t * 8.0f) % 8;
+					output[n] = (step / 3.5f) - 1.0f;
+				}
+			}
+
+			void RenderNoise(float* output, const WaveKernelParams& p) {
+				if (CanRenderSpectrally(p)) {
+					HarmonicSpectrum spectrum(p.numSamples);
+					for (int k = 1; k <= p.maxHarmonics; ++k) {
+						float phaseOffset = (float)(k * 123456789u % 1000) / 1000.0f;
+						spectrum.AddPartial(k, 1.0f / (float)k, phaseOffset * 2 * PI);
+					}
+					spectrum.Render(*p.frequencyProcessor, output);
+					return;
+				}
+
+				Clear(output, p.numSamples);
+				for (int k = 1; k <= p.maxHarmonics; ++k) {
+					float phaseOffset = (float)(k * 123456789u % 1000) / 1000.0f;
+					float amplitude = 1.0f / (float)k;
+					double w = 2 * PI * k;
+					double offset = phaseOffset * 2 * PI;
+					for (size_t n = 0; n < p.numSamples; ++n) {
+						double t = Phase(n, p.numSamples);
+						output[n] += amplitude * (float)sin(w * t + offset);
+					}
+				}
+			}
+
+			void RenderProcedural(float* output, const WaveKernelParams& p) {
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					output[n] = (float)std::tanh(3.0 * sin(2 * PI * t));
+				}
+			}
+
+			void RenderSinc(float* output, const WaveKernelParams& p) {
+				// Sinc function: sin(x)/x
+				// Map t (0..1) to range -8PI to 8PI to show multiple lobes
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float x = ((float)t - 0.5f) * 16.0f * (float)PI;
+					if (std::abs(x) < 0.001f) {
+						output[n] = 1.0f;
+					}
+					else {
+						output[n] = (float)sin(x) / x;
+					}
+				}
+			}
+
+			// ===== TAB 6: MODULATION SYNTHESIS =====
+
+			void RenderRingMod(float* output, const WaveKernelParams& p) {
+				// Ring modulation - classic metallic sound
+				const double wMod = 2 * PI * 3.7f; // Inharmonic ratio
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float carrier = (float)sin(2 * PI * t);
+					float modulator = (float)sin(wMod * t);
+					output[n] = carrier * modulator;
+				}
+			}
+
+			void RenderAmplitudeMod(float* output, const WaveKernelParams& p) {
+				// Amplitude modulation
+				const double wMod = 2 * PI * 0.3f; // Slow modulation
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float carrier = (float)sin(2 * PI * t);
+					float modulator = (float)sin(wMod * t);
+					output[n] = carrier * (0.5f + 0.5f * modulator);
+				}
+			}
+
+			void RenderFrequencyMod(float* output, const WaveKernelParams& p) {
+				// Deep FM synthesis
+				const float modIndex = 2.0f;
+				const double wMod = 2 * PI * 2.5f; // C:M ratio
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float modulator = modIndex * (float)sin(wMod * t);
+					output[n] = (float)sin(2 * PI * t + modulator);
+				}
+			}
+
+			void RenderCrossMod(float* output, const WaveKernelParams& p) {
+				// Cross modulation - bidirectional FM
+				const double w2 = 2 * PI * 1.5f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float mod1 = (float)sin(2 * PI * t);
+					float mod2 = (float)sin(w2 * t);
+					float result1 = (float)sin(2 * PI * t + mod2 * 0.5f);
+					float result2 = (float)sin(w2 * t + mod1 * 0.5f);
+					output[n] = (result1 + result2) * 0.5f;
+				}
+			}
+
+			void RenderPhaseMod(float* output, const WaveKernelParams& p) {
+				// Phase modulation synthesis
+				const float modIndex = 1.5f;
+				const double wMod = 2 * PI * 3.0f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float modulator = modIndex * (float)sin(wMod * t);
+					output[n] = (float)sin(2 * PI * t + modulator);
+				}
+			}
+
+			// ===== TAB 7: PHYSICAL MODELS =====
+
+			void RenderString(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 1; k <= p.maxHarmonics; ++k)
+						add(k, (float)(k * k));
+				});
+			}
+
+			void RenderBrass(float* output, const WaveKernelParams& p) {
+				RenderHarmonicPartials(output, p, [&](auto add) {
+					for (int k = 1; k <= p.maxHarmonics; k += 2)
+						add(k, k * 0.8f);
+				});
+			}
+
+			void RenderReed(float* output, const WaveKernelParams& p) {
+				// Bandlimited clarinet-like (odd harmonics)
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = (float)sin(2 * PI * t);
+					val += 0.3f * (float)sin(2 * PI * 3 * t);
+					output[n] = val;
+				}
+			}
+
+			void RenderVocal(float* output, const WaveKernelParams& p) {
+				// Bandlimited vowel formants
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = 0.0f;
+					val += (float)sin(2 * PI * 2 * t) * 1.0f;
+					val += (float)sin(2 * PI * 3 * t) * 0.6f;
+					output[n] = val;
+				}
+			}
+
+			void RenderBell(float* output, const WaveKernelParams& p) {
+				// Bandlimited bell-like
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float val = (float)sin(2 * PI * t);
+					val += 0.5f * (float)sin(2 * PI * 2 * t);
+					val += 0.35f * (float)sin(2 * PI * 3 * t);
+					output[n] = val;
+				}
+			}
+
+			// ===== TAB 8: SYNTHESIS WAVES =====
+
+			void RenderSimpleFM(float* output, const WaveKernelParams& p) {
+				// Reduced modulation index for bandlimiting
+				const float modIndex = 0.3f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float carrier = (float)(2 * PI * t);
+					float modulator = (float)sin(2 * PI * 2 * t) * modIndex;
+					output[n] = (float)sin(carrier + modulator);
+				}
+			}
+
+			void RenderComplexFM(float* output, const WaveKernelParams& p) {
+				// Reduced modulation for bandlimiting
+				const float modIndex1 = 0.2f;
+				const float modIndex2 = 0.15f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float carrier = (float)(2 * PI * t);
+					float mod1 = (float)sin(2 * PI * 2 * t) * modIndex1;
+					float mod2 = (float)sin(2 * PI * 3 * t) * modIndex2;
+					output[n] = (float)sin(carrier + mod1 + mod2);
+				}
+			}
+
+			void RenderPhaseDistortion(float* output, const WaveKernelParams& p) {
+				// Reduced phase modulation for bandlimiting
+				const double phaseMod = 0.08;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					double phase = t + phaseMod * sin(2 * PI * t);
+					output[n] = (float)sin(2 * PI * phase);
+				}
+			}
+
+			void RenderWavefold(float* output, const WaveKernelParams& p) {
+				// Reduced wavefolding for bandlimiting
+				const float amplitude = 1.3f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float x = (float)sin(2 * PI * t) * amplitude;
+					x = x > 1.0f ? 2.0f - x : x;
+					x = x < -1.0f ? -2.0f - x : x;
+					output[n] = x;
+				}
+			}
+
+			void RenderHardSync(float* output, const WaveKernelParams& p) {
+				// Bandlimited hard sync
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					value += 0.4f * (float)sin(2 * PI * 2 * t);
+					value += 0.2f * (float)sin(2 * PI * 3 * t);
+					output[n] = value;
+				}
+			}
+
+			void RenderChebyshev(float* output, const WaveKernelParams& p) {
+				// T3: 4x^3 - 3x (generates 3rd harmonic)
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float x = (float)sin(2 * PI * t);
+					output[n] = 4.0f * x * x * x - 3.0f * x;
+				}
+			}
+
+			// ===== TAB 9: VINTAGE SYNTH EMULATIONS =====
+
+			void RenderARPOdyssey(float* output, const WaveKernelParams& p) {
+				// ARP Odyssey - raw, aggressive oscillators with wide range
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float saw = 2.0f * (float)t - 1.0f;
+					float tri = 1.0f - 4.0f * std::abs((float)t - 0.5f);
+					// Blend saw and triangle with emphasis on odd harmonics
+					float blend = (saw * 0.7f + tri * 0.3f);
+					blend += 0.15f * (float)sin(6 * PI * t); // Odd harmonic emphasis
+					output[n] = blend - 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+				}
+			}
+
+			void RenderCS80(float* output, const WaveKernelParams& p) {
+				// Yamaha CS-80 - lush, warm, thick analog pads
+				float dt = 1.0f / (float)p.numSamples;
+				const double wLfo = 2 * PI * 0.3f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float saw1 = 2.0f * (float)t - 1.0f;
+					float saw2 = 2.0f * fmodf((float)t * 1.003f, 1.0f) - 1.0f;
+					float saw3 = 2.0f * fmodf((float)t * 0.997f, 1.0f) - 1.0f;
+					float saw4 = 2.0f * fmodf((float)t * 1.001f, 1.0f) - 1.0f;
+					// Four detuned oscillators with subtle chorus
+					float lfo = (float)sin(wLfo * t) * 0.002f;
+					float blend = (saw1 + saw2 + saw3 + saw4 * (1.0f + lfo)) / 4.0f;
+					// Add warmth with low-pass character
+					blend = blend * 0.85f + 0.15f * (float)sin(2 * PI * t);
+					output[n] = blend - 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+				}
+			}
+
+			void RenderJuno(float* output, const WaveKernelParams& p) {
+				// Juno-style saw with chorus character
+				float dt = 1.0f / (float)p.numSamples;
+				const double wLfo = 2 * PI * 0.5f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float saw1 = 2.0f * (float)t - 1.0f;
+					float saw2 = 2.0f * fmodf((float)t * 1.005f, 1.0f) - 1.0f;
+					float lfo = (float)sin(wLfo * t) * 0.003f;
+					float chorus = 2.0f * fmodf((float)t * (1.0f + lfo), 1.0f) - 1.0f;
+					output[n] = (saw1 * 0.5f + saw2 * 0.3f + chorus * 0.2f) - 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+				}
+			}
+
+			void RenderMiniMoog(float* output, const WaveKernelParams& p) {
+				// Minimoog-style saw with slight detuning and warmth
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float saw1 = 2.0f * (float)t - 1.0f;
+					float saw2 = 2.0f * fmodf((float)t * 1.002f, 1.0f) - 1.0f; // Slight detune
+					float saw3 = 2.0f * fmodf((float)t * 0.998f, 1.0f) - 1.0f;
+					float blend = (saw1 + saw2 * 0.7f + saw3 * 0.7f) / 2.4f;
+					output[n] = blend - 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+				}
+			}
+
+			void RenderMS20(float* output, const WaveKernelParams& p) {
+				// Korg MS-20 - aggressive, acidic, raw with distinctive filter
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					// Add resonant peak at different frequency than TB-303
+					value = value + 0.4f * (float)sin(10 * PI * t);
+					// Hard clipping for aggressive character
+					output[n] = std::tanh(value * 1.5f);
+				}
+			}
+
+			void RenderOberheim(float* output, const WaveKernelParams& p) {
+				// Oberheim SEM style - rich multi-mode character
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float saw = 2.0f * (float)t - 1.0f - 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					float pulse = ((float)t < 0.5f ? 1.0f : -1.0f) - WaveKernels::PolyBLEP((float)t, dt)
+						+ WaveKernels::PolyBLEP(fmodf((float)t + 0.5f, 1.0f), dt);
+					output[n] = (saw * 0.6f + pulse * 0.4f);
+				}
+			}
+
+			void RenderPPG(float* output, const WaveKernelParams& p) {
+				// PPG Wave style - digital stepped waveshape
+				const int steps = 64;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					int step = (int)(t * steps) % steps;
+					float phase = (float)step / (float)steps;
+					output[n] = (float)sin(2 * PI * phase) * 0.7f + (2.0f * phase - 1.0f) * 0.3f;
+				}
+			}
+
+			void RenderProphet5(float* output, const WaveKernelParams& p) {
+				// Prophet-5 style saw - smoother, less harsh
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					// Add slight warmth with 2nd harmonic
+					value = value * 0.8f + 0.2f * (float)sin(4 * PI * t);
+					output[n] = value;
+				}
+			}
+
+			void RenderTB303(float* output, const WaveKernelParams& p) {
+				// TB-303 style saw - bright and acidic
+				float dt = 1.0f / (float)p.numSamples;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float value = 2.0f * (float)t - 1.0f;
+					value -= 2.0f * WaveKernels::PolyBLEP((float)t, dt);
+					// Add resonant peak simulation
+					value = value + 0.3f * (float)sin(8 * PI * t);
+					output[n] = std::tanh(value * 1.2f); // Slight saturation
+				}
+			}
+
+			// ===== TAB 10: VOWEL FORMANTS =====
+
+			// Three fixed formants relative to middle C (261.63 Hz), hoisted out of the sample loop
+			void RenderVowel(float* output, size_t numSamples, double f1Hz, double f2Hz, double f3Hz,
+				float a2, float a3, float scale) {
+				const double w1 = 2 * PI * f1Hz / 261.63;
+				const double w2 = 2 * PI * f2Hz / 261.63;
+				const double w3 = 2 * PI * f3Hz / 261.63;
+				for (size_t n = 0; n < numSamples; ++n) {
+					double t = Phase(n, numSamples);
+					float f1 = (float)sin(w1 * t);
+					float f2 = (float)sin(w2 * t) * a2;
+					float f3 = (float)sin(w3 * t) * a3;
+					output[n] = (f1 + f2 + f3) / scale;
+				}
+			}
+
+			void RenderVowelA(float* output, const WaveKernelParams& p) {
+				// Vowel "A" (as in "father") - F1=730Hz, F2=1090Hz, F3=2440Hz
+				RenderVowel(output, p.numSamples, 730.0, 1090.0, 2440.0, 0.7f, 0.3f, 2.0f);
+			}
+
+			void RenderVowelE(float* output, const WaveKernelParams& p) {
+				// Vowel "E" (as in "bed") - F1=530Hz, F2=1840Hz, F3=2480Hz
+				RenderVowel(output, p.numSamples, 530.0, 1840.0, 2480.0, 0.8f, 0.3f, 2.1f);
+			}
+
+			void RenderVowelI(float* output, const WaveKernelParams& p) {
+				// Vowel "I" (as in "see") - F1=270Hz, F2=2290Hz, F3=3010Hz
+				RenderVowel(output, p.numSamples, 270.0, 2290.0, 3010.0, 0.9f, 0.4f, 2.3f);
+			}
+
+			void RenderVowelO(float* output, const WaveKernelParams& p) {
+				// Vowel "O" (as in "go") - F1=570Hz, F2=840Hz, F3=2410Hz
+				RenderVowel(output, p.numSamples, 570.0, 840.0, 2410.0, 0.7f, 0.2f, 1.9f);
+			}
+
+			void RenderVowelU(float* output, const WaveKernelParams& p) {
+				// Vowel "U" (as in "boot") - F1=300Hz, F2=870Hz, F3=2240Hz
+				RenderVowel(output, p.numSamples, 300.0, 870.0, 2240.0, 0.6f, 0.2f, 1.8f);
+			}
+
+			void RenderDiphthong(float* output, const WaveKernelParams& p) {
+				// Morphing vowel (A to I)
+				const float f1a = 730.0f, f1i = 270.0f;
+				const float f2a = 1090.0f, f2i = 2290.0f;
+				const double wMorph = 2 * PI * 0.25f;
+				for (size_t n = 0; n < p.numSamples; ++n) {
+					double t = Phase(n, p.numSamples);
+					float morph = (float)sin(wMorph * t) * 0.5f + 0.5f; // 0 to 1
+					float f1 = f1a + (f1i - f1a) * morph;
+					float f2 = f2a + (f2i - f2a) * morph;
+					float formant1 = (float)sin(2 * PI * f1 / 261.63 * t);
+					float formant2 = (float)sin(2 * PI * f2 / 261.63 * t) * 0.8f;
+					output[n] = (formant1 + formant2) / 1.8f;
+				}
+			}
+
+			// Kernel table indexed by WaveType (must stay in enum declaration order)
+			constexpr WaveKernel KERNELS[] = {
+				// TAB 0: Basic Waves
+				RenderSine, RenderSquare, RenderTriangle, RenderSaw, RenderReverseSaw, RenderPulse,
+				// TAB 1: Chaos Theory
+				RenderLorenz, RenderRossler, RenderHenon, RenderDuffing, RenderChua, RenderLogisticChaos,
+				// TAB 2: Fractals
+				RenderWeierstrass, RenderCantor, RenderKoch, RenderMandelbrot,
+				// TAB 3: Harmonic Waves
+				RenderOddHarmonics, RenderEvenHarmonics, RenderHarmonicSeries, RenderSubHarmonics,
+				RenderFormant, RenderAdditive,
+				// TAB 4: Inharmonic Series
+				RenderStretchedHarm, RenderCompressedHarm, RenderMetallic, RenderClangorous,
+				RenderKarplusStrong, RenderStiffString,
+				// TAB 5: Modern/Digital + Mathematical
+				RenderSupersaw, RenderPWMSaw, RenderParabolic, RenderDoubleSine, RenderHalfSine,
+				RenderTrapezoid, RenderPower, RenderExponential, RenderLogistic, RenderStepped,
+				RenderNoise, RenderProcedural, RenderSinc,
+				// TAB 6: Modulation Synthesis
+				RenderRingMod, RenderAmplitudeMod, RenderFrequencyMod, RenderCrossMod, RenderPhaseMod,
+				// TAB 7: Physical Models
+				RenderString, RenderBrass, RenderReed, RenderVocal, RenderBell,
+				// TAB 8: Synthesis Waves
+				RenderSimpleFM, RenderComplexFM, RenderPhaseDistortion, RenderWavefold, RenderHardSync,
+				RenderChebyshev,
+				// TAB 9: Vintage Synth Emulation
+				RenderARPOdyssey, RenderCS80, RenderJuno, RenderMiniMoog, RenderMS20, RenderOberheim,
+				RenderPPG, RenderProphet5, RenderTB303,
+				// TAB 10: Vowel Formants
+				RenderVowelA, RenderVowelE, RenderVowelI, RenderVowelO, RenderVowelU, RenderDiphthong
+			};
+
+			constexpr size_t NUM_KERNELS = sizeof(KERNELS) / sizeof(KERNELS[0]);
+			static_assert(NUM_KERNELS == static_cast<size_t>(WaveType::Diphthong) + 1,
+				"Every WaveType needs exactly one kernel in enum order");
+		}
+
+		WaveKernel WaveKernels::Get(WaveType type, GenerationPrecision precision) {
+			WaveKernel kernel = nullptr;
+			if (precision == GenerationPrecision::Fast) {
+				kernel = BasicWaveKernels::Get(type);
+				if (!kernel) kernel = FastWaveKernels::Get(type);
+			}
+			else if (BasicWaveKernels::IsExact(type)) {
+				kernel = BasicWaveKernels::Get(type);
+			}
+			return kernel ? kernel : GetScalar(type);
+		}
+
+		float WaveKernels::PartialRatio(WaveType type, int harmonic) {
+			switch (type) {
+			case WaveType::StretchedHarm:
+				return (float)pow(harmonic, 1.05); // Slightly stretched
+			case WaveType::CompressedHarm:
+				return (float)pow(harmonic, 0.95); // Slightly compressed
+			case WaveType::StiffString: {
+				const float B = 0.0001f; // Inharmonicity coefficient
+				return (float)harmonic * (float)sqrt(1.0f + B * harmonic * harmonic);
+			}
+			default:
+				return (float)harmonic;
+			}
+		}
+
+		WaveKernel WaveKernels::GetScalar(WaveType type) {
+			size_t index = static_cast<size_t>(type);
+			return index < NUM_KERNELS ? KERNELS[index] : RenderSine;
+		}
+	}
+}
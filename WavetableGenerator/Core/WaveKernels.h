@@ -0,0 +1,68 @@
+#ifndef WAVEKERNELS_H
+#define WAVEKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "WaveType.h"
+#include "GenerationContext.h"
+
+namespace WavetableGen {
+	namespace DSP {
+		class IFrequencyProcessor;
+	}
+
+	namespace Core {
+		// Per-call parameters shared by all waveform kernels
+		struct WaveKernelParams {
+			size_t numSamples = 0;
+			double pulseDuty = 0.5;
+			int maxHarmonics = 8;
+
+			// Seed for randomized kernels (see WaveKernels::UsesSeed)
+			uint64_t seed = 1;
+
+			// Inverse FFT used by the integer-harmonic kernels to render spectrally
+			// (nullptr keeps them on the time-domain path)
+			DSP::IFrequencyProcessor* frequencyProcessor = nullptr;
+		};
+
+		// A kernel renders one whole cycle of a single WaveType (DC offset not removed)
+		typedef void (*WaveKernel)(float* output, const WaveKernelParams& params);
+
+		// Compile-time table of waveform kernels, one per WaveType (Open/Closed Principle)
+		// The kernel is selected once per cycle instead of switching on the type for every sample,
+		// so each inner loop is branch-free and per-type constants are hoisted out of it
+		class WaveKernels {
+		public:
+			// Get the kernel that renders the given wave type
+			// Exact: the scalar reference, or a vectorized kernel where that one is bit-exact
+			// Fast: vectorized and approximated where possible (see FastWaveKernels::GetMaxError)
+			static WaveKernel Get(WaveType type, GenerationPrecision precision = GenerationPrecision::Exact);
+
+			// Get the scalar reference kernel for the given wave type
+			static WaveKernel GetScalar(WaveType type);
+
+			// Frequency ratio of partial 'harmonic' (1-based) of the inharmonic series types
+			// (StretchedHarm, CompressedHarm, StiffString); 'harmonic' itself for any other type
+			static float PartialRatio(WaveType type, int harmonic);
+
+			// True if the kernel's output depends on WaveKernelParams::seed
+			static bool UsesSeed(WaveType type) { return type == WaveType::KarplusStrong; }
+
+			// PolyBLEP (Polynomial Band-Limited Step) for anti-aliasing
+			static inline float PolyBLEP(float t, float dt) {
+				if (t < dt) {
+					t = t / dt;
+					return t + t - t * t - 1.0f;
+				}
+				else if (t > 1.0f - dt) {
+					t = (t - 1.0f) / dt;
+					return t * t + t + t + 1.0f;
+				}
+				return 0.0f;
+			}
+		};
+	}
+}
+
+#endif // WAVEKERNELS_H
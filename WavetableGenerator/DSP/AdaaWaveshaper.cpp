@@ -0,0 +1,207 @@
+#include "AdaaWaveshaper.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			// Below this input difference the divided differences fall back to a midpoint value
+			const double TOLERANCE = 1e-5;
+			const double LN2 = 0.69314718055994530942;
+			const double PI_SQUARED_OVER_12 = 0.82246703342411321824;
+
+			// ln(cosh(u)) without overflow
+			double LogCosh(double u) {
+				double a = std::abs(u);
+				return a + std::log1p(std::exp(-2.0 * a)) - LN2;
+			}
+
+			// Dilogarithm Li2(w) for w in [0, 0.5]: Bernoulli series in v = -ln(1 - w) <= ln 2
+			// (sum of B_n v^(n+1) / (n+1)!, truncated below 1e-16)
+			double Dilog(double w) {
+				double v = -std::log1p(-w);
+				double v2 = v * v;
+				double odd = -1.9939295860721074e-14;
+				odd = odd * v2 + 8.921691020456452e-13;
+				odd = odd * v2 - 4.0647616451442256e-11;
+				odd = odd * v2 + 1.8978869988971e-09;
+				odd = odd * v2 - 9.185773074661964e-08;
+				odd = odd * v2 + 4.72411186696901e-06;
+				odd = odd * v2 - 2.777777777777778e-04;
+				odd = odd * v2 + 2.7777777777777776e-02;
+				return v - 0.25 * v2 + odd * v2 * v;
+			}
+
+			// Integral of ln(cosh(t)) from 0 to u (odd in u)
+			// For u >= 0: u^2/2 - u ln 2 + (Li2(-e^(-2u)) + PI^2/12) / 2, with Li2 of the negative
+			// argument from the Landen identity Li2(z) = -Li2(z / (z - 1)) - ln^2(1 - z) / 2
+			double LogCoshIntegral(double u) {
+				double a = std::abs(u);
+				double z = -std::exp(-2.0 * a);
+				double log1MinusZ = std::log1p(-z);
+				double li2 = -Dilog(z / (z - 1.0)) - 0.5 * log1MinusZ * log1MinusZ;
+				double g = 0.5 * a * a - a * LN2 + 0.5 * (li2 + PI_SQUARED_OVER_12);
+				return u < 0.0 ? -g : g;
+			}
+
+			// Each shape provides f (F0) and its first and second antiderivatives (F1, F2),
+			// all zero at x = 0
+
+			// tanh(drive * x)
+			struct SoftClip {
+				double drive;
+				double F0(double x) const { return std::tanh(drive * x); }
+				double F1(double x) const { return LogCosh(drive * x) / drive; }
+				double F2(double x) const { return LogCoshIntegral(drive * x) / (drive * drive); }
+			};
+
+			// tanh(drive * x), with half the drive on the negative side
+			struct AsymmetricClip {
+				double drive;
+				double Drive(double x) const { return x > 0.0 ? drive : drive * 0.5; }
+				double F0(double x) const { return std::tanh(Drive(x) * x); }
+				double F1(double x) const { double d = Drive(x); return LogCosh(d * x) / d; }
+				double F2(double x) const { double d = Drive(x); return LogCoshIntegral(d * x) / (d * d); }
+			};
+
+			// Clamp to [-threshold, threshold]
+			struct HardClip {
+				double threshold;
+				double F0(double x) const { return std::min(std::max(x, -threshold), threshold); }
+				double F1(double x) const {
+					double t = threshold;
+					return std::abs(x) <= t ? 0.5 * x * x : t * std::abs(x) - 0.5 * t * t;
+				}
+				double F2(double x) const {
+					double t = threshold;
+					if (std::abs(x) <= t) return x * x * x / 6.0;
+					double sign = x > 0.0 ? 1.0 : -1.0;
+					return sign * (0.5 * t * x * x + t * t * t / 6.0) - 0.5 * t * t * x;
+				}
+			};
+
+			// Triangle fold of gain * x with period 4: 1 - |m - 2|, m = (gain * x + 1) mod 4
+			struct TriangleFold {
+				double gain;
+
+				// Period index k and position m in [0, 4) of u = gain * x
+				static void Split(double u, double& k, double& m) {
+					double v = u + 1.0;
+					k = std::floor(v * 0.25);
+					m = v - 4.0 * k;
+				}
+				double F0(double x) const {
+					double k, m;
+					Split(gain * x, k, m);
+					return 1.0 - std::abs(m - 2.0);
+				}
+				double F1(double x) const {
+					// Periodic: (m - 1)^2 / 2 on the rising half, 1 - (3 - m)^2 / 2 on the falling half
+					double k, m;
+					Split(gain * x, k, m);
+					double t1 = m < 2.0 ? 0.5 * (m - 1.0) * (m - 1.0) : 1.0 - 0.5 * (3.0 - m) * (3.0 - m);
+					return t1 / gain;
+				}
+				double F2(double x) const {
+					// F1 integrates to 2 over each period; -1/6 is the integral from 0 back to m = 0
+					double k, m;
+					Split(gain * x, k, m);
+					double partial = m < 2.0
+						? ((m - 1.0) * (m - 1.0) * (m - 1.0) + 1.0) / 6.0
+						: 1.0 / 3.0 + (m - 2.0) + ((3.0 - m) * (3.0 - m) * (3.0 - m) - 1.0) / 6.0;
+					return (-1.0 / 6.0 + 2.0 * k + partial) / (gain * gain);
+				}
+			};
+
+			// First order: y[n] averages f over [x[n-1], x[n]]
+			template <class Shape>
+			void ProcessFirstOrder(const float* x, float* y, size_t n, const Shape& shape) {
+				double x1 = x[n - 1];
+				double f1Prev = shape.F1(x1);
+				for (size_t i = 0; i < n; ++i) {
+					double x0 = x[i];
+					double f1 = shape.F1(x0);
+					double diff = x0 - x1;
+					y[i] = (float)(std::abs(diff) < TOLERANCE ? shape.F0(0.5 * (x0 + x1)) : (f1 - f1Prev) / diff);
+					x1 = x0;
+					f1Prev = f1;
+				}
+			}
+
+			// Second order: y[n] from x[n-1], x[n], x[n+1], centered on x[n]
+			template <class Shape>
+			void ProcessSecondOrder(const float* x, float* y, size_t n, const Shape& shape) {
+				// Divided difference of F2 (F1 at the midpoint when ill-conditioned)
+				auto divided = [&](double a, double b, double f2a, double f2b) {
+					double diff = a - b;
+					return std::abs(diff) < TOLERANCE ? shape.F1(0.5 * (a + b)) : (f2a - f2b) / diff;
+				};
+
+				double x2 = x[(n - 1) % n];
+				double x1 = x[0];
+				double f2x2 = shape.F2(x2);
+				double f2x1 = shape.F2(x1);
+				double d2 = divided(x1, x2, f2x1, f2x2);
+
+				for (size_t i = 0; i < n; ++i) {
+					double x0 = x[(i + 1) % n];
+					double f2x0 = shape.F2(x0);
+					double d1 = divided(x0, x1, f2x0, f2x1);
+
+					double out;
+					if (std::abs(x0 - x2) >= TOLERANCE) {
+						out = 2.0 / (x0 - x2) * (d1 - d2);
+					}
+					else {
+						// x[n-1] ~ x[n+1]: expand around their mean instead
+						double xBar = 0.5 * (x0 + x2);
+						double delta = xBar - x1;
+						out = std::abs(delta) < TOLERANCE
+							? shape.F0(0.5 * (xBar + x1))
+							: 2.0 / delta * (shape.F1(xBar) + (f2x1 - shape.F2(xBar)) / delta);
+					}
+					y[i] = (float)out;
+
+					x2 = x1;
+					x1 = x0;
+					f2x1 = f2x0;
+					d2 = d1;
+				}
+			}
+
+			template <class Shape>
+			void ApplyShape(float* samples, size_t n, const Shape& shape, AntiAliasing order, float* scratch) {
+				std::copy(samples, samples + n, scratch);
+				if (order == AntiAliasing::ADAA1) {
+					ProcessFirstOrder(scratch, samples, n, shape);
+				}
+				else {
+					ProcessSecondOrder(scratch, samples, n, shape);
+				}
+			}
+		}
+
+		void AdaaWaveshaper::Process(float* samples, size_t numSamples, const WaveshaperParams& params,
+			AntiAliasing order, float* scratch) {
+			if (numSamples == 0 || order == AntiAliasing::Oversampling) return;
+
+			switch (params.distortionType) {
+			case DistortionType::Soft:
+				ApplyShape(samples, numSamples, SoftClip{ params.softDrive }, order, scratch);
+				break;
+			case DistortionType::Hard:
+				ApplyShape(samples, numSamples, HardClip{ params.hardThreshold }, order, scratch);
+				break;
+			case DistortionType::Asymmetric:
+				ApplyShape(samples, numSamples, AsymmetricClip{ params.asymmetricDrive }, order, scratch);
+				break;
+			default:
+				break;
+			}
+
+			if (params.wavefold) {
+				ApplyShape(samples, numSamples, TriangleFold{ params.foldGain }, order, scratch);
+			}
+		}
+	}
+}
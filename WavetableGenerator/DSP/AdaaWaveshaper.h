@@ -0,0 +1,30 @@
+#ifndef ADAAWAVESHAPER_H
+#define ADAAWAVESHAPER_H
+
+#include "WaveshaperKernels.h"
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Core {
+		// Antiderivative anti-aliasing (ADAA) for the distortion and wavefold nonlinearities
+		// Instead of evaluating f(x) at each sample, ADAA averages f over the segment between
+		// consecutive samples through its antiderivatives, which suppresses aliasing at the base
+		// rate without oversampling:
+		//   first order:  y[n] = (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1])
+		//   second order: the same divided difference taken once more on F2, centered on x[n]
+		// First order delays the signal by half a sample; second order is centered.
+		// A frame is one period, so it is processed circularly (no edge transients).
+		// Internally double precision: the divided differences cancel heavily.
+		class AdaaWaveshaper {
+		public:
+			// Apply the distortion, then the wavefold, of params to one period in place
+			// (bit crush is not handled here)
+			// order: ADAA1 or ADAA2
+			// scratch: numSamples floats
+			static void Process(float* samples, size_t numSamples, const WaveshaperParams& params,
+				AntiAliasing order, float* scratch);
+		};
+	}
+}
+
+#endif // ADAAWAVESHAPER_H
@@ -0,0 +1,160 @@
+#include "EffectChain.h"
+#include "FrequencyProcessorFactory.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		EffectChain::EffectChain(const EffectsSettings& settings, size_t frameSize)
+			: m_frameSize(frameSize)
+			, m_filterKernel(FrameFilterKernels::Get()) {
+			// Order matters for quality:
+			// 1. Symmetry operations (no frequency content changes)
+			// 2. Aliasing-prone effects (with oversampling)
+			// 3. Filtering (removes unwanted frequencies)
+			// 4. Spectral effects (frequency domain processing)
+			m_stages.reserve((size_t)StageType::Spectral + 1); // At most one stage of each type
+
+			// Step 1: Symmetry operations (safe, no oversampling needed)
+			if (settings.reverse) {
+				AddStage(StageType::Reverse);
+			}
+			if (settings.mirrorHorizontal) {
+				AddStage(StageType::MirrorHorizontal);
+			}
+			if (settings.mirrorVertical != settings.invert) {
+				AddStage(StageType::Negate);
+			}
+
+			// Step 2: Non-linear effects, sharing a single oversample/decimate round trip
+			if (settings.distortionType != DistortionType::None && settings.distortionAmount > 0.001f) {
+				m_nonlinear.distortionType = settings.distortionType;
+				m_nonlinear.distortionAmount = settings.distortionAmount;
+			}
+			m_nonlinear.antiAliasing = settings.antiAliasing;
+			m_nonlinear.quality = settings.oversamplingQuality;
+			if (settings.enableWavefold && settings.wavefoldAmount > 0.001f) {
+				m_nonlinear.wavefoldAmount = settings.wavefoldAmount;
+			}
+			if (settings.enableBitCrush && settings.bitDepth < 16) {
+				m_nonlinear.bitDepth = settings.bitDepth;
+			}
+			if (settings.enableSampleRateReduction && settings.sampleRateReductionFactor > 1) {
+				m_nonlinear.sampleRateReductionFactor = settings.sampleRateReductionFactor;
+			}
+			if (!m_nonlinear.IsEmpty()) {
+				AddStage(StageType::Nonlinear);
+				m_nonlinearScratch.resize(WaveformEffects::GetNonlinearScratchSize(frameSize));
+			}
+
+			// Step 3: Filtering (removes aliasing and shapes spectrum)
+			if (settings.enableHighPass && settings.highPassCutoff > 0.001f) {
+				AddStage(StageType::HighPass, FrameFilter::Design(settings.filterType, FilterMode::HighPass,
+					settings.highPassCutoff, settings.filterResonance));
+			}
+			if (settings.enableLowPass && settings.lowPassCutoff < 0.999f) {
+				AddStage(StageType::LowPass, FrameFilter::Design(settings.filterType, FilterMode::LowPass,
+					settings.lowPassCutoff, settings.filterResonance));
+			}
+
+			// Step 4: Spectral effects (frequency domain processing), merged into one FFT round trip
+			if (settings.enableSpectralDecay && settings.spectralDecayAmount > 0.001f) {
+				AddSpectralStage(SpectralOperation::Decay, settings.spectralDecayAmount, settings.spectralDecayCurve);
+			}
+			if (settings.enableSpectralTilt && std::abs(settings.spectralTiltAmount) > 0.001f) {
+				AddSpectralStage(SpectralOperation::Tilt, settings.spectralTiltAmount);
+			}
+			if (settings.enableSpectralGate && settings.spectralGateThreshold > 0.001f) {
+				AddSpectralStage(SpectralOperation::Gate, settings.spectralGateThreshold);
+			}
+			if (settings.enablePhaseRandomize && settings.phaseRandomizeAmount > 0.001f) {
+				AddSpectralStage(SpectralOperation::PhaseRandomize, settings.phaseRandomizeAmount);
+			}
+			if (settings.enableSpectralShift && settings.spectralShiftAmount != 0) {
+				AddSpectralStage(SpectralOperation::Shift, 0.0f, 0.0f, settings.spectralShiftAmount);
+			}
+			if (!m_spectralStages.empty() && frameSize > 0) {
+				// FFT plan and scratch for the padded frame size
+				int fftSize = 1;
+				while ((size_t)fftSize < frameSize) {
+					fftSize <<= 1;
+				}
+				m_spectral.reset(new SpectralEffects(DSP::FrequencyProcessorFactory::Create(fftSize)));
+				m_spectral->Reserve(FrameFilterKernels::MAX_BATCH_FRAMES, frameSize);
+			}
+		}
+
+		void EffectChain::AddStage(StageType type, const FrameFilter& filter) {
+			Stage stage;
+			stage.type = type;
+			stage.filter = filter;
+			m_stages.push_back(stage);
+		}
+
+		void EffectChain::AddSpectralStage(SpectralOperation operation, float amount, float curve, int shiftAmount) {
+			// The first spectral effect adds the stage, the others join its round trip
+			if (m_spectralStages.empty()) {
+				AddStage(StageType::Spectral);
+			}
+
+			SpectralStage stage;
+			stage.operation = operation;
+			stage.amount = amount;
+			stage.curve = curve;
+			stage.shiftAmount = shiftAmount;
+			m_spectralStages.push_back(stage);
+		}
+
+		void EffectChain::Process(float* samples, uint64_t seed) {
+			ProcessFrames(samples, 1, &seed);
+		}
+
+		void EffectChain::ProcessFrames(float* frames, size_t numFrames, const uint64_t* seeds) {
+			const size_t n = m_frameSize;
+			if (n == 0) return;
+
+			// Stage by stage over a batch of frames: the filters take the whole batch into SIMD
+			// lanes, the spectral stage transforms it with one batched FFT each way, the other stages
+			// run frame by frame. Every stage works in place.
+			for (size_t first = 0; first < numFrames; first += FrameFilterKernels::MAX_BATCH_FRAMES) {
+				const size_t count = (std::min)(numFrames - first, FrameFilterKernels::MAX_BATCH_FRAMES);
+				float* batch = frames + first * n;
+
+				for (const Stage& stage : m_stages) {
+					if (stage.type == StageType::HighPass || stage.type == StageType::LowPass) {
+						m_filterKernel(batch, count, n, stage.filter);
+						continue;
+					}
+					if (stage.type == StageType::Spectral) {
+						m_spectral->ApplyStagesBatch(batch, count, n, m_spectralStages.data(), m_spectralStages.size(), seeds + first);
+						continue;
+					}
+					for (size_t i = 0; i < count; ++i) {
+						ProcessStage(stage, batch + i * n);
+					}
+				}
+			}
+		}
+
+		void EffectChain::ProcessStage(const Stage& stage, float* samples) {
+			const size_t n = m_frameSize;
+			switch (stage.type) {
+			case StageType::Reverse:
+				WaveformEffects::ApplyReverse(samples, n);
+				break;
+			case StageType::MirrorHorizontal:
+				WaveformEffects::ApplyMirrorHorizontal(samples, n);
+				break;
+			case StageType::Negate:
+				WaveformEffects::ApplyInvert(samples, n);
+				break;
+			case StageType::Nonlinear:
+				WaveformEffects::ApplyNonlinearStage(samples, n, m_nonlinear, m_nonlinearScratch.data());
+				break;
+			default:
+				// HighPass, LowPass and Spectral run batched in ProcessFrames
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef EFFECTCHAIN_H
+#define EFFECTCHAIN_H
+
+#include "WaveformEffects.h"
+#include "SpectralEffects.h"
+#include "FrameFilterKernels.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace WavetableGen {
+	namespace Core {
+		// Effects pipeline compiled from EffectsSettings (Single Responsibility Principle)
+		// The settings are resolved once into the list of enabled stages, in the order ApplyEffects
+		// documents, and every buffer the stages need is sized for the frame length up front.
+		// Process() and ProcessFrames() then run any number of frames without heap allocations.
+		// Not thread-safe: give each thread its own chain.
+		class EffectChain {
+		public:
+			// frameSize: samples per frame passed to Process
+			EffectChain(const EffectsSettings& settings, size_t frameSize);
+
+			EffectChain(const EffectChain&) = delete;
+			EffectChain& operator=(const EffectChain&) = delete;
+
+			// Apply the enabled effects to one frame of GetFrameSize() samples in place
+			// seed: drives the randomized effects (phase randomization), so results are reproducible
+			void Process(float* samples, uint64_t seed);
+
+			// Apply the enabled effects to numFrames contiguous frames in place, like calling
+			// Process on each. The recursive filters run on up to
+			// FrameFilterKernels::MAX_BATCH_FRAMES frames at once, one frame per SIMD lane, and the
+			// spectral stage transforms as many with one batched FFT. A frame filtered in a SIMD
+			// lane may differ from Process by FrameFilterKernels::GetMaxError where the compiler
+			// contracts the filter arithmetic into FMA.
+			// seeds: one seed per frame
+			void ProcessFrames(float* frames, size_t numFrames, const uint64_t* seeds);
+
+			size_t GetFrameSize() const { return m_frameSize; }
+
+			// True when no effect is enabled (Process leaves frames unchanged)
+			bool IsEmpty() const { return m_stages.empty(); }
+
+		private:
+			enum class StageType {
+				Reverse,
+				MirrorHorizontal,
+				Negate,          // Mirror vertical and invert (both enabled cancel out)
+				Nonlinear,       // Fused oversampled distortion/wavefold/bit crush/rate reduction
+				HighPass,
+				LowPass,
+				Spectral         // All spectral effects in one FFT round trip
+			};
+
+			struct Stage {
+				StageType type;
+				FrameFilter filter; // HighPass/LowPass coefficients
+			};
+
+			void AddStage(StageType type, const FrameFilter& filter = FrameFilter());
+			void AddSpectralStage(SpectralOperation operation, float amount, float curve = 0.0f, int shiftAmount = 0);
+
+			// One of the per-frame stages (all but the filters and the spectral stage) on one frame
+			void ProcessStage(const Stage& stage, float* samples);
+
+			std::vector<Stage> m_stages;
+			size_t m_frameSize;
+
+			// Batched filter kernel for the running CPU
+			FrameFilterKernel m_filterKernel;
+
+			// Oversampled pass and its scratch (only allocated when a nonlinear effect is enabled)
+			WaveformEffects::NonlinearStage m_nonlinear;
+			std::vector<float> m_nonlinearScratch;
+
+			// Bin operations of the spectral stage, with their own FFT processor and scratch
+			// (only created when a spectral effect is enabled)
+			std::vector<SpectralStage> m_spectralStages;
+			std::unique_ptr<SpectralEffects> m_spectral;
+		};
+	}
+}
+
+#endif // EFFECTCHAIN_H
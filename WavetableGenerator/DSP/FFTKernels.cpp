@@ -0,0 +1,214 @@
+#include "FFTKernels.h"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace WavetableGen {
+	namespace DSP {
+		RealFFTPlan::RealFFTPlan(size_t size)
+			: fftSize(size)
+			, complexSize(size / 2)
+			, numRadix4Passes(0)
+			, radix2Pass(false) {
+			if (size < 2 || (size & (size - 1)) != 0) {
+				throw std::invalid_argument("FFT size must be a power of 2");
+			}
+
+			const double pi = 3.14159265358979323846;
+			size_t m = complexSize;
+
+			// M = 4^passes (* 2 when log2(M) is odd)
+			size_t n = m;
+			while (n >= 4) {
+				size_t quarter = n / 4;
+				for (size_t j = 1; j <= 3; ++j) {
+					for (size_t p = 0; p < quarter; ++p) {
+						double angle = -2.0 * pi * (double)(j * p) / (double)n;
+						twiddleRe.push_back((float)std::cos(angle));
+						twiddleIm.push_back((float)std::sin(angle));
+					}
+				}
+				++numRadix4Passes;
+				n = quarter;
+			}
+			radix2Pass = n == 2;
+
+			splitRe.resize(m);
+			splitIm.resize(m);
+			for (size_t k = 0; k < m; ++k) {
+				double angle = -2.0 * pi * (double)k / (double)size;
+				splitRe[k] = (float)std::cos(angle);
+				splitIm[k] = (float)std::sin(angle);
+			}
+
+			bufferRe.resize(m);
+			bufferIm.resize(m);
+			workRe.resize(m);
+			workIm.resize(m);
+		}
+
+		RealFFTKernel FFTKernels::Get(FFTDirection direction) {
+			return Get(direction, Utils::CpuFeatures::GetSimdLevel());
+		}
+
+		RealFFTKernel FFTKernels::Get(FFTDirection direction, Utils::SimdLevel level) {
+			RealFFTKernel kernel = nullptr;
+
+			// Fall back to the next lower instruction set if a level was not compiled in
+			switch (level) {
+			case Utils::SimdLevel::AVX512:
+				kernel = GetAVX512(direction);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::AVX2:
+				kernel = GetAVX2(direction);
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::SSE2:
+				kernel = GetSSE2(direction);
+				break;
+			default:
+				break;
+			}
+
+			if (kernel) return kernel;
+			return direction == FFTDirection::Forward ? ForwardScalar : InverseScalar;
+		}
+
+		namespace {
+			// Forward complex FFT of plan.bufferRe/Im; re/im point at the result afterwards
+			// (the buffers or the work arrays, depending on the number of passes)
+			void ComplexPassesScalar(RealFFTPlan& plan, float*& re, float*& im) {
+				float* srcRe = plan.bufferRe.data();
+				float* srcIm = plan.bufferIm.data();
+				float* dstRe = plan.workRe.data();
+				float* dstIm = plan.workIm.data();
+				const float* twRe = plan.twiddleRe.data();
+				const float* twIm = plan.twiddleIm.data();
+
+				size_t n = plan.complexSize;
+				size_t s = 1;
+				for (int pass = 0; pass < plan.numRadix4Passes; ++pass) {
+					size_t m = n / 4;
+					for (size_t p = 0; p < m; ++p) {
+						float w1r = twRe[p], w1i = twIm[p];
+						float w2r = twRe[m + p], w2i = twIm[m + p];
+						float w3r = twRe[2 * m + p], w3i = twIm[2 * m + p];
+						for (size_t q = 0; q < s; ++q) {
+							size_t in = q + s * p;
+							size_t out = q + s * 4 * p;
+							float ar = srcRe[in], ai = srcIm[in];
+							float br = srcRe[in + s * m], bi = srcIm[in + s * m];
+							float cr = srcRe[in + 2 * s * m], ci = srcIm[in + 2 * s * m];
+							float dr = srcRe[in + 3 * s * m], di = srcIm[in + 3 * s * m];
+
+							float apcR = ar + cr, apcI = ai + ci;
+							float amcR = ar - cr, amcI = ai - ci;
+							float bpdR = br + dr, bpdI = bi + di;
+							float bmdR = br - dr, bmdI = bi - di;
+
+							// (a - c) -/+ i(b - d) and (a + c) - (b + d), then the twiddles
+							float t1r = amcR + bmdI, t1i = amcI - bmdR;
+							float t2r = apcR - bpdR, t2i = apcI - bpdI;
+							float t3r = amcR - bmdI, t3i = amcI + bmdR;
+
+							dstRe[out] = apcR + bpdR;
+							dstIm[out] = apcI + bpdI;
+							dstRe[out + s] = t1r * w1r - t1i * w1i;
+							dstIm[out + s] = t1r * w1i + t1i * w1r;
+							dstRe[out + 2 * s] = t2r * w2r - t2i * w2i;
+							dstIm[out + 2 * s] = t2r * w2i + t2i * w2r;
+							dstRe[out + 3 * s] = t3r * w3r - t3i * w3i;
+							dstIm[out + 3 * s] = t3r * w3i + t3i * w3r;
+						}
+					}
+					twRe += 3 * m;
+					twIm += 3 * m;
+					std::swap(srcRe, dstRe);
+					std::swap(srcIm, dstIm);
+					n = m;
+					s *= 4;
+				}
+
+				if (plan.radix2Pass) {
+					for (size_t q = 0; q < s; ++q) {
+						float ar = srcRe[q], ai = srcIm[q];
+						float br = srcRe[q + s], bi = srcIm[q + s];
+						dstRe[q] = ar + br;
+						dstIm[q] = ai + bi;
+						dstRe[q + s] = ar - br;
+						dstIm[q + s] = ai - bi;
+					}
+					std::swap(srcRe, dstRe);
+					std::swap(srcIm, dstIm);
+				}
+
+				re = srcRe;
+				im = srcIm;
+			}
+		}
+
+		void FFTKernels::ForwardScalar(RealFFTPlan& plan, const float* input, float* output) {
+			size_t m = plan.complexSize;
+
+			// Even samples as the real part, odd samples as the imaginary part
+			for (size_t k = 0; k < m; ++k) {
+				plan.bufferRe[k] = input[2 * k];
+				plan.bufferIm[k] = input[2 * k + 1];
+			}
+
+			float* zr;
+			float* zi;
+			ComplexPassesScalar(plan, zr, zi);
+
+			// DC and Nyquist
+			output[0] = zr[0] + zi[0];
+			output[1] = 0.0f;
+			output[2 * m] = zr[0] - zi[0];
+			output[2 * m + 1] = 0.0f;
+
+			// X[k] = even + e^(-2*PI*i*k/N) * odd, with even = (Z[k] + conj(Z[M-k])) / 2 and
+			// odd = -i * (Z[k] - conj(Z[M-k])) / 2
+			for (size_t k = 1; k < m; ++k) {
+				float ar = zr[k], ai = zi[k];
+				float br = zr[m - k], bi = -zi[m - k];
+				float er = (ar + br) * 0.5f, ei = (ai + bi) * 0.5f;
+				float dr = (ar - br) * 0.5f, di = (ai - bi) * 0.5f;
+				float or_ = di, oi = -dr;
+				float wr = plan.splitRe[k], wi = plan.splitIm[k];
+				output[2 * k] = er + (or_ * wr - oi * wi);
+				output[2 * k + 1] = ei + (or_ * wi + oi * wr);
+			}
+		}
+
+		void FFTKernels::InverseScalar(RealFFTPlan& plan, const float* input, float* output) {
+			size_t m = plan.complexSize;
+			float half = 0.5f / (float)m; // The 1/M of the inverse folded in
+
+			// Z[k] = even + i * odd, with even = (X[k] + conj(X[M-k])) / 2 and
+			// odd = (X[k] - conj(X[M-k])) / 2 * e^(2*PI*i*k/N)
+			// The inverse transform runs as a forward one on swapped real/imaginary parts
+			// (swap(FFT(swap(Z))) is the unscaled inverse), so Z is stored swapped
+			for (size_t k = 0; k < m; ++k) {
+				float ar = input[2 * k], ai = input[2 * k + 1];
+				float br = input[2 * (m - k)], bi = -input[2 * (m - k) + 1];
+				float er = (ar + br) * half, ei = (ai + bi) * half;
+				float dr = (ar - br) * half, di = (ai - bi) * half;
+				float wr = plan.splitRe[k], wi = -plan.splitIm[k];
+				float or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+				plan.bufferIm[k] = er - oi;
+				plan.bufferRe[k] = ei + or_;
+			}
+
+			float* zr;
+			float* zi;
+			ComplexPassesScalar(plan, zr, zi);
+
+			// Swapped back: the real part is in zi
+			for (size_t k = 0; k < m; ++k) {
+				output[2 * k] = zi[k];
+				output[2 * k + 1] = zr[k];
+			}
+		}
+	}
+}
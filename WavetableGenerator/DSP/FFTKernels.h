@@ -0,0 +1,70 @@
+#ifndef FFTKERNELS_H
+#define FFTKERNELS_H
+
+#include "../Utils/CpuFeatures.h"
+#include <cstddef>
+#include <vector>
+
+namespace WavetableGen {
+	namespace DSP {
+		enum class FFTDirection {
+			Forward, // N real samples -> N/2+1 complex bins
+			Inverse  // N/2+1 complex bins -> N real samples (scaled by 1/N)
+		};
+
+		// Tables and scratch of one real FFT size (Single Responsibility Principle)
+		// A real FFT of size N runs as a complex FFT of size M = N/2 on the even/odd samples, split
+		// into the real spectrum afterwards. The complex FFT is a self-sorting (Stockham) radix-4
+		// transform in split format (separate real and imaginary arrays), with one radix-2 pass when
+		// M is not a power of 4. Everything is computed once here; the kernels never allocate.
+		// The scratch makes a plan single-threaded: one plan per thread.
+		struct RealFFTPlan {
+			size_t fftSize;     // N (power of 2, at least 2)
+			size_t complexSize; // M = N/2
+			int numRadix4Passes;
+			bool radix2Pass;
+
+			// Per radix-4 pass with sub-transform length n (M, M/4, ...): w^p, w^2p, w^3p for
+			// p < n/4 with w = e^(-2*PI*i/n), as three consecutive blocks of n/4 values
+			std::vector<float> twiddleRe, twiddleIm;
+
+			// e^(-2*PI*i*k/N) for k < M: recombines the even/odd half spectra
+			std::vector<float> splitRe, splitIm;
+
+			// Two split-complex buffers of M values the passes ping-pong between
+			std::vector<float> bufferRe, bufferIm, workRe, workIm;
+
+			explicit RealFFTPlan(size_t fftSize);
+		};
+
+		// Forward: input N floats, output N/2+1 interleaved (re, im) pairs
+		// Inverse: input N/2+1 interleaved (re, im) pairs, output N floats
+		// Input and output must not overlap
+		typedef void (*RealFFTKernel)(RealFFTPlan& plan, const float* input, float* output);
+
+		// Real FFT kernels
+		// The butterflies and twiddle multiplications run on V::Width values at once; the first pass
+		// (stride 1) and the even/odd split use 4-wide SSE with in-register transposes. The
+		// instruction set is picked at runtime like Core::FastWaveKernels.
+		class FFTKernels {
+		public:
+			// Best kernel for the running CPU
+			static RealFFTKernel Get(FFTDirection direction);
+
+			// Kernel for a specific instruction set (Scalar, or the next lower level that was compiled in)
+			static RealFFTKernel Get(FFTDirection direction, Utils::SimdLevel level);
+
+			// Reference kernels (same passes, one value at a time)
+			static void ForwardScalar(RealFFTPlan& plan, const float* input, float* output);
+			static void InverseScalar(RealFFTPlan& plan, const float* input, float* output);
+
+		private:
+			// One entry point per instruction set (see FFTKernelsSSE2/AVX2/AVX512.cpp)
+			static RealFFTKernel GetSSE2(FFTDirection direction);
+			static RealFFTKernel GetAVX2(FFTDirection direction);
+			static RealFFTKernel GetAVX512(FFTDirection direction);
+		};
+	}
+}
+
+#endif // FFTKERNELS_H
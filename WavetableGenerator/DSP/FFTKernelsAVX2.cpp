@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX2 (see WavetableGenerator.vcxproj)
+#include "FFTKernels.h"
+#include "FFTKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace DSP {
+		RealFFTKernel FFTKernels::GetAVX2(FFTDirection direction) {
+#if defined(WTG_HAS_AVX2)
+			return direction == FFTDirection::Forward ? FFTKernelsSimd<Utils::VecAVX2>::Forward : FFTKernelsSimd<Utils::VecAVX2>::Inverse;
+#else
+			(void)direction;
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,16 @@
+// Compiled with /arch:AVX512 (see WavetableGenerator.vcxproj)
+#include "FFTKernels.h"
+#include "FFTKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace DSP {
+		RealFFTKernel FFTKernels::GetAVX512(FFTDirection direction) {
+#if defined(WTG_HAS_AVX512)
+			return direction == FFTDirection::Forward ? FFTKernelsSimd<Utils::VecAVX512>::Forward : FFTKernelsSimd<Utils::VecAVX512>::Inverse;
+#else
+			(void)direction;
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,16 @@
+// SSE2 is the x64 baseline, so no extra /arch flag is needed
+#include "FFTKernels.h"
+#include "FFTKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace DSP {
+		RealFFTKernel FFTKernels::GetSSE2(FFTDirection direction) {
+#if defined(WTG_HAS_SSE2)
+			return direction == FFTDirection::Forward ? FFTKernelsSimd<Utils::VecSSE2>::Forward : FFTKernelsSimd<Utils::VecSSE2>::Inverse;
+#else
+			(void)direction;
+			return nullptr;
+#endif
+		}
+	}
+}
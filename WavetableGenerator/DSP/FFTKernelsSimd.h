@@ -0,0 +1,336 @@
+#ifndef FFTKERNELSSIMD_H
+#define FFTKERNELSSIMD_H
+
+// Instruction-set independent implementation of the real FFT kernels.
+// Only include this from the per-ISA translation units (FFTKernelsSSE2/AVX2/AVX512.cpp):
+// it is instantiated once per vector type from Utils/SimdVector.h.
+//
+// Every pass performs the same operations per value, in the same order, as
+// FFTKernels::ForwardScalar/InverseScalar. A radix-4 pass with stride s reads and writes runs of
+// s consecutive values, so it vectorizes along the run: with V::Width lanes once s is that wide,
+// with 4 SSE lanes for s = 4, and across butterflies (4 at a time, transposed into place) for the
+// first pass, where s = 1. The even/odd split reads bins k and M - k together; it uses 4-wide SSE
+// with a lane reversal, which every instruction set level includes.
+
+#include "FFTKernels.h"
+#include "../Utils/SimdVector.h"
+#include <xmmintrin.h>
+#include <utility>
+
+namespace WavetableGen {
+	namespace DSP {
+		namespace {
+			template <class V>
+			class FFTKernelsSimd {
+				typedef Utils::VecSSE2 S;
+
+			public:
+				static void Forward(RealFFTPlan& plan, const float* input, float* output) {
+					size_t m = plan.complexSize;
+					float* bufferRe = plan.bufferRe.data();
+					float* bufferIm = plan.bufferIm.data();
+
+					// Even samples as the real part, odd samples as the imaginary part
+					size_t k = 0;
+					for (; k + 4 <= m; k += 4) {
+						__m128 lo = _mm_loadu_ps(input + 2 * k);
+						__m128 hi = _mm_loadu_ps(input + 2 * k + 4);
+						_mm_storeu_ps(bufferRe + k, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+						_mm_storeu_ps(bufferIm + k, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+					}
+					for (; k < m; ++k) {
+						bufferRe[k] = input[2 * k];
+						bufferIm[k] = input[2 * k + 1];
+					}
+
+					float* zr;
+					float* zi;
+					ComplexPasses(plan, zr, zi);
+
+					// DC and Nyquist
+					output[0] = zr[0] + zi[0];
+					output[1] = 0.0f;
+					output[2 * m] = zr[0] - zi[0];
+					output[2 * m + 1] = 0.0f;
+
+					const float* splitRe = plan.splitRe.data();
+					const float* splitIm = plan.splitIm.data();
+					S::Reg halfV = S::Set1(0.5f);
+					k = 1;
+					for (; k + 4 <= m; k += 4) {
+						S::Reg ar = S::Load(zr + k), ai = S::Load(zi + k);
+						S::Reg br = Reverse(S::Load(zr + m - k - 3));
+						S::Reg bi = S::Sub(S::Set1(0.0f), Reverse(S::Load(zi + m - k - 3)));
+						S::Reg er = S::Mul(S::Add(ar, br), halfV), ei = S::Mul(S::Add(ai, bi), halfV);
+						S::Reg dr = S::Mul(S::Sub(ar, br), halfV), di = S::Mul(S::Sub(ai, bi), halfV);
+						S::Reg or_ = di, oi = S::Sub(S::Set1(0.0f), dr);
+						S::Reg wr = S::Load(splitRe + k), wi = S::Load(splitIm + k);
+						S::Reg xr = S::Add(er, S::Sub(S::Mul(or_, wr), S::Mul(oi, wi)));
+						S::Reg xi = S::Add(ei, S::Add(S::Mul(or_, wi), S::Mul(oi, wr)));
+						_mm_storeu_ps(output + 2 * k, _mm_unpacklo_ps(xr, xi));
+						_mm_storeu_ps(output + 2 * k + 4, _mm_unpackhi_ps(xr, xi));
+					}
+					for (; k < m; ++k) {
+						float ar = zr[k], ai = zi[k];
+						float br = zr[m - k], bi = -zi[m - k];
+						float er = (ar + br) * 0.5f, ei = (ai + bi) * 0.5f;
+						float dr = (ar - br) * 0.5f, di = (ai - bi) * 0.5f;
+						float or_ = di, oi = -dr;
+						float wr = splitRe[k], wi = splitIm[k];
+						output[2 * k] = er + (or_ * wr - oi * wi);
+						output[2 * k + 1] = ei + (or_ * wi + oi * wr);
+					}
+				}
+
+				static void Inverse(RealFFTPlan& plan, const float* input, float* output) {
+					size_t m = plan.complexSize;
+					float half = 0.5f / (float)m;
+					float* bufferRe = plan.bufferRe.data();
+					float* bufferIm = plan.bufferIm.data();
+					const float* splitRe = plan.splitRe.data();
+					const float* splitIm = plan.splitIm.data();
+
+					// Z stored with real and imaginary parts swapped (see InverseScalar)
+					S::Reg halfV = S::Set1(half);
+					size_t k = 0;
+					for (; k + 4 <= m; k += 4) {
+						__m128 lo = _mm_loadu_ps(input + 2 * k);
+						__m128 hi = _mm_loadu_ps(input + 2 * k + 4);
+						S::Reg ar = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+						S::Reg ai = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+						__m128 mirrorLo = _mm_loadu_ps(input + 2 * (m - k - 3));
+						__m128 mirrorHi = _mm_loadu_ps(input + 2 * (m - k - 3) + 4);
+						S::Reg br = Reverse(_mm_shuffle_ps(mirrorLo, mirrorHi, _MM_SHUFFLE(2, 0, 2, 0)));
+						S::Reg bi = S::Sub(S::Set1(0.0f), Reverse(_mm_shuffle_ps(mirrorLo, mirrorHi, _MM_SHUFFLE(3, 1, 3, 1))));
+						S::Reg er = S::Mul(S::Add(ar, br), halfV), ei = S::Mul(S::Add(ai, bi), halfV);
+						S::Reg dr = S::Mul(S::Sub(ar, br), halfV), di = S::Mul(S::Sub(ai, bi), halfV);
+						S::Reg wr = S::Load(splitRe + k), wi = S::Sub(S::Set1(0.0f), S::Load(splitIm + k));
+						S::Reg or_ = S::Sub(S::Mul(dr, wr), S::Mul(di, wi));
+						S::Reg oi = S::Add(S::Mul(dr, wi), S::Mul(di, wr));
+						S::Store(bufferIm + k, S::Sub(er, oi));
+						S::Store(bufferRe + k, S::Add(ei, or_));
+					}
+					for (; k < m; ++k) {
+						float ar = input[2 * k], ai = input[2 * k + 1];
+						float br = input[2 * (m - k)], bi = -input[2 * (m - k) + 1];
+						float er = (ar + br) * half, ei = (ai + bi) * half;
+						float dr = (ar - br) * half, di = (ai - bi) * half;
+						float wr = splitRe[k], wi = -splitIm[k];
+						float or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+						bufferIm[k] = er - oi;
+						bufferRe[k] = ei + or_;
+					}
+
+					float* zr;
+					float* zi;
+					ComplexPasses(plan, zr, zi);
+
+					// Swapped back: the real part is in zi
+					k = 0;
+					for (; k + 4 <= m; k += 4) {
+						S::Reg re = S::Load(zi + k), im = S::Load(zr + k);
+						_mm_storeu_ps(output + 2 * k, _mm_unpacklo_ps(re, im));
+						_mm_storeu_ps(output + 2 * k + 4, _mm_unpackhi_ps(re, im));
+					}
+					for (; k < m; ++k) {
+						output[2 * k] = zi[k];
+						output[2 * k + 1] = zr[k];
+					}
+				}
+
+			private:
+				static __m128 Reverse(__m128 v) {
+					return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3));
+				}
+
+				// Split-complex operands and results of one radix-4 butterfly
+				template <class U>
+				struct Butterfly {
+					typedef typename U::Reg Reg;
+					Reg y0r, y0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+					Butterfly(Reg ar, Reg ai, Reg br, Reg bi, Reg cr, Reg ci, Reg dr, Reg di) {
+						Reg apcR = U::Add(ar, cr), apcI = U::Add(ai, ci);
+						Reg amcR = U::Sub(ar, cr), amcI = U::Sub(ai, ci);
+						Reg bpdR = U::Add(br, dr), bpdI = U::Add(bi, di);
+						Reg bmdR = U::Sub(br, dr), bmdI = U::Sub(bi, di);
+						t1r = U::Add(amcR, bmdI); t1i = U::Sub(amcI, bmdR);
+						t2r = U::Sub(apcR, bpdR); t2i = U::Sub(apcI, bpdI);
+						t3r = U::Sub(amcR, bmdI); t3i = U::Add(amcI, bmdR);
+						y0r = U::Add(apcR, bpdR); y0i = U::Add(apcI, bpdI);
+					}
+
+					// (xr + i*xi) * (wr + i*wi)
+					static void Twiddle(Reg xr, Reg xi, Reg wr, Reg wi, Reg& yr, Reg& yi) {
+						yr = U::Sub(U::Mul(xr, wr), U::Mul(xi, wi));
+						yi = U::Add(U::Mul(xr, wi), U::Mul(xi, wr));
+					}
+				};
+
+				// Butterflies p of one pass, vectorized along the run of s values (U::Width divides s)
+				template <class U>
+				static void Radix4Strided(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm,
+					size_t m, size_t s, const float* twRe, const float* twIm) {
+					typedef typename U::Reg Reg;
+					for (size_t p = 0; p < m; ++p) {
+						Reg w1r = U::Set1(twRe[p]), w1i = U::Set1(twIm[p]);
+						Reg w2r = U::Set1(twRe[m + p]), w2i = U::Set1(twIm[m + p]);
+						Reg w3r = U::Set1(twRe[2 * m + p]), w3i = U::Set1(twIm[2 * m + p]);
+						for (size_t q = 0; q < s; q += U::Width) {
+							size_t in = q + s * p;
+							size_t out = q + s * 4 * p;
+							Butterfly<U> b(U::Load(srcRe + in), U::Load(srcIm + in),
+								U::Load(srcRe + in + s * m), U::Load(srcIm + in + s * m),
+								U::Load(srcRe + in + 2 * s * m), U::Load(srcIm + in + 2 * s * m),
+								U::Load(srcRe + in + 3 * s * m), U::Load(srcIm + in + 3 * s * m));
+							Reg yr, yi;
+							U::Store(dstRe + out, b.y0r);
+							U::Store(dstIm + out, b.y0i);
+							Butterfly<U>::Twiddle(b.t1r, b.t1i, w1r, w1i, yr, yi);
+							U::Store(dstRe + out + s, yr);
+							U::Store(dstIm + out + s, yi);
+							Butterfly<U>::Twiddle(b.t2r, b.t2i, w2r, w2i, yr, yi);
+							U::Store(dstRe + out + 2 * s, yr);
+							U::Store(dstIm + out + 2 * s, yi);
+							Butterfly<U>::Twiddle(b.t3r, b.t3i, w3r, w3i, yr, yi);
+							U::Store(dstRe + out + 3 * s, yr);
+							U::Store(dstIm + out + 3 * s, yi);
+						}
+					}
+				}
+
+				// First pass (s = 1): four butterflies at once, outputs transposed into place
+				// (m must be a multiple of 4)
+				static void Radix4First(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm,
+					size_t m, const float* twRe, const float* twIm) {
+					for (size_t p = 0; p < m; p += 4) {
+						Butterfly<S> b(S::Load(srcRe + p), S::Load(srcIm + p),
+							S::Load(srcRe + p + m), S::Load(srcIm + p + m),
+							S::Load(srcRe + p + 2 * m), S::Load(srcIm + p + 2 * m),
+							S::Load(srcRe + p + 3 * m), S::Load(srcIm + p + 3 * m));
+						__m128 y0r = b.y0r, y0i = b.y0i, y1r, y1i, y2r, y2i, y3r, y3i;
+						Butterfly<S>::Twiddle(b.t1r, b.t1i, S::Load(twRe + p), S::Load(twIm + p), y1r, y1i);
+						Butterfly<S>::Twiddle(b.t2r, b.t2i, S::Load(twRe + m + p), S::Load(twIm + m + p), y2r, y2i);
+						Butterfly<S>::Twiddle(b.t3r, b.t3i, S::Load(twRe + 2 * m + p), S::Load(twIm + 2 * m + p), y3r, y3i);
+
+						// Lane j of yr holds output 4 * (p + j) + r
+						_MM_TRANSPOSE4_PS(y0r, y1r, y2r, y3r);
+						_MM_TRANSPOSE4_PS(y0i, y1i, y2i, y3i);
+						float* outRe = dstRe + 4 * p;
+						float* outIm = dstIm + 4 * p;
+						_mm_storeu_ps(outRe, y0r);
+						_mm_storeu_ps(outRe + 4, y1r);
+						_mm_storeu_ps(outRe + 8, y2r);
+						_mm_storeu_ps(outRe + 12, y3r);
+						_mm_storeu_ps(outIm, y0i);
+						_mm_storeu_ps(outIm + 4, y1i);
+						_mm_storeu_ps(outIm + 8, y2i);
+						_mm_storeu_ps(outIm + 12, y3i);
+					}
+				}
+
+				// Tiny transforms (m < 4 in the first pass) one value at a time
+				static void Radix4Scalar(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm,
+					size_t m, size_t s, const float* twRe, const float* twIm) {
+					for (size_t p = 0; p < m; ++p) {
+						for (size_t q = 0; q < s; ++q) {
+							size_t in = q + s * p;
+							size_t out = q + s * 4 * p;
+							float ar = srcRe[in], ai = srcIm[in];
+							float br = srcRe[in + s * m], bi = srcIm[in + s * m];
+							float cr = srcRe[in + 2 * s * m], ci = srcIm[in + 2 * s * m];
+							float dr = srcRe[in + 3 * s * m], di = srcIm[in + 3 * s * m];
+							float apcR = ar + cr, apcI = ai + ci;
+							float amcR = ar - cr, amcI = ai - ci;
+							float bpdR = br + dr, bpdI = bi + di;
+							float bmdR = br - dr, bmdI = bi - di;
+							float t1r = amcR + bmdI, t1i = amcI - bmdR;
+							float t2r = apcR - bpdR, t2i = apcI - bpdI;
+							float t3r = amcR - bmdI, t3i = amcI + bmdR;
+							dstRe[out] = apcR + bpdR;
+							dstIm[out] = apcI + bpdI;
+							dstRe[out + s] = t1r * twRe[p] - t1i * twIm[p];
+							dstIm[out + s] = t1r * twIm[p] + t1i * twRe[p];
+							dstRe[out + 2 * s] = t2r * twRe[m + p] - t2i * twIm[m + p];
+							dstIm[out + 2 * s] = t2r * twIm[m + p] + t2i * twRe[m + p];
+							dstRe[out + 3 * s] = t3r * twRe[2 * m + p] - t3i * twIm[2 * m + p];
+							dstIm[out + 3 * s] = t3r * twIm[2 * m + p] + t3i * twRe[2 * m + p];
+						}
+					}
+				}
+
+				template <class U>
+				static void Radix2(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm, size_t s) {
+					for (size_t q = 0; q < s; q += U::Width) {
+						typename U::Reg ar = U::Load(srcRe + q), ai = U::Load(srcIm + q);
+						typename U::Reg br = U::Load(srcRe + q + s), bi = U::Load(srcIm + q + s);
+						U::Store(dstRe + q, U::Add(ar, br));
+						U::Store(dstIm + q, U::Add(ai, bi));
+						U::Store(dstRe + q + s, U::Sub(ar, br));
+						U::Store(dstIm + q + s, U::Sub(ai, bi));
+					}
+				}
+
+				// Forward complex FFT of plan.bufferRe/Im; re/im point at the result afterwards
+				static void ComplexPasses(RealFFTPlan& plan, float*& re, float*& im) {
+					float* srcRe = plan.bufferRe.data();
+					float* srcIm = plan.bufferIm.data();
+					float* dstRe = plan.workRe.data();
+					float* dstIm = plan.workIm.data();
+					const float* twRe = plan.twiddleRe.data();
+					const float* twIm = plan.twiddleIm.data();
+
+					size_t n = plan.complexSize;
+					size_t s = 1;
+					for (int pass = 0; pass < plan.numRadix4Passes; ++pass) {
+						size_t m = n / 4;
+						if (s >= (size_t)V::Width) {
+							Radix4Strided<V>(srcRe, srcIm, dstRe, dstIm, m, s, twRe, twIm);
+						}
+						else if (s >= 4) {
+							Radix4Strided<S>(srcRe, srcIm, dstRe, dstIm, m, s, twRe, twIm);
+						}
+						else if (m >= 4) {
+							Radix4First(srcRe, srcIm, dstRe, dstIm, m, twRe, twIm);
+						}
+						else {
+							Radix4Scalar(srcRe, srcIm, dstRe, dstIm, m, s, twRe, twIm);
+						}
+						twRe += 3 * m;
+						twIm += 3 * m;
+						std::swap(srcRe, dstRe);
+						std::swap(srcIm, dstIm);
+						n = m;
+						s *= 4;
+					}
+
+					if (plan.radix2Pass) {
+						if (s >= (size_t)V::Width) {
+							Radix2<V>(srcRe, srcIm, dstRe, dstIm, s);
+						}
+						else if (s >= 4) {
+							Radix2<S>(srcRe, srcIm, dstRe, dstIm, s);
+						}
+						else {
+							for (size_t q = 0; q < s; ++q) {
+								float ar = srcRe[q], ai = srcIm[q];
+								float br = srcRe[q + s], bi = srcIm[q + s];
+								dstRe[q] = ar + br;
+								dstIm[q] = ai + bi;
+								dstRe[q + s] = ar - br;
+								dstIm[q + s] = ai - bi;
+							}
+						}
+						std::swap(srcRe, dstRe);
+						std::swap(srcIm, dstIm);
+					}
+
+					re = srcRe;
+					im = srcIm;
+				}
+			};
+		}
+	}
+}
+
+#endif // FFTKERNELSSIMD_H
@@ -0,0 +1,82 @@
+#include "FFTPlanCache.h"
+#include "../../third_party/kiss_fft/kiss_fft.h"
+#include "../Utils/ThreadPool.h"
+#include <memory>
+#include <stdexcept>
+
+namespace WavetableGen {
+	namespace DSP {
+		namespace {
+			// One thread's plans, indexed by log2 of the size
+			struct ThreadPlans {
+				std::unique_ptr<RealFFTPlan> plans[FFTPlanCache::MAX_LOG2_SIZE + 1];
+				kiss_fftr_cfg kissPlans[FFTPlanCache::MAX_LOG2_SIZE + 1][2] = {};
+
+				~ThreadPlans() {
+					for (auto& directions : kissPlans) {
+						for (kiss_fftr_cfg plan : directions) {
+							if (plan) kiss_fftr_free(plan);
+						}
+					}
+				}
+			};
+
+			ThreadPlans& GetThreadPlans() {
+				thread_local ThreadPlans plans;
+				return plans;
+			}
+		}
+
+		int FFTPlanCache::Log2Size(size_t fftSize) {
+			if (fftSize < 2 || (fftSize & (fftSize - 1)) != 0) return -1;
+
+			int log2 = 0;
+			while (((size_t)1 << log2) < fftSize) {
+				++log2;
+			}
+			return log2 <= MAX_LOG2_SIZE ? log2 : -1;
+		}
+
+		RealFFTPlan& FFTPlanCache::GetPlan(size_t fftSize) {
+			int index = Log2Size(fftSize);
+			if (index < 0) {
+				throw std::invalid_argument("FFT size must be a power of 2");
+			}
+
+			std::unique_ptr<RealFFTPlan>& plan = GetThreadPlans().plans[index];
+			if (!plan) {
+				plan.reset(new RealFFTPlan(fftSize));
+			}
+			return *plan;
+		}
+
+		kiss_fftr_cfg FFTPlanCache::GetKissPlan(size_t fftSize, FFTDirection direction) {
+			int index = Log2Size(fftSize);
+			if (index < 0) {
+				throw std::invalid_argument("FFT size must be a power of 2");
+			}
+
+			int inverse = direction == FFTDirection::Inverse ? 1 : 0;
+			kiss_fftr_cfg& plan = GetThreadPlans().kissPlans[index][inverse];
+			if (!plan) {
+				plan = kiss_fftr_alloc((int)fftSize, inverse, nullptr, nullptr);
+				if (!plan) {
+					throw std::runtime_error("Failed to allocate FFT configuration");
+				}
+			}
+			return plan;
+		}
+
+		void FFTPlanCache::ForEachFrameRange(size_t numFrames, size_t fftSize,
+			const std::function<void(size_t, size_t)>& body) {
+			if (numFrames == 0) return;
+
+			size_t grain = (PARALLEL_CHUNK_SAMPLES + fftSize - 1) / fftSize;
+			if (numFrames <= grain) {
+				body(0, numFrames);
+				return;
+			}
+			Utils::ThreadPool::GetShared().ParallelFor(0, numFrames, grain, body);
+		}
+	}
+}
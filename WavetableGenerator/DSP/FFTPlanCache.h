@@ -0,0 +1,49 @@
+#ifndef FFTPLANCACHE_H
+#define FFTPLANCACHE_H
+
+#include "FFTKernels.h"
+#include <cstddef>
+#include <functional>
+
+// Forward declarations to avoid exposing KissFFT in header
+struct kiss_fftr_state;
+typedef struct kiss_fftr_state* kiss_fftr_cfg;
+
+namespace WavetableGen {
+	namespace DSP {
+		// Per-thread registry of FFT plans, one per size (and direction for KissFFT)
+		// Plans hold scratch, so they cannot be shared between threads, and building one costs far
+		// more than a transform. Each thread builds a size's plan once, on first use, and keeps it
+		// until the thread exits; the handles are non-owning. Processors look their plan up on
+		// every transform instead of owning one, so switching sizes (256-sample imports next to
+		// 2048-sample frames) never reallocates, and a processor never touches another thread's
+		// plan.
+		class FFTPlanCache {
+		public:
+			// Largest supported size is 2^MAX_LOG2_SIZE
+			static const int MAX_LOG2_SIZE = 24;
+
+			// Batches are split across threads in chunks of at least this many samples
+			static const size_t PARALLEL_CHUNK_SAMPLES = 32768;
+
+			// The calling thread's plan for fftSize (power of 2, at least 2), for both directions
+			// Throws std::invalid_argument for other sizes
+			static RealFFTPlan& GetPlan(size_t fftSize);
+
+			// The calling thread's KissFFT plan for fftSize and direction
+			static kiss_fftr_cfg GetKissPlan(size_t fftSize, FFTDirection direction);
+
+			// Run body(firstFrame, lastFrame) over a batch of numFrames frames of fftSize samples:
+			// on the calling thread for small batches, in chunks on the shared thread pool for large
+			// ones (each chunk then transforms with its own thread's plan)
+			static void ForEachFrameRange(size_t numFrames, size_t fftSize,
+				const std::function<void(size_t, size_t)>& body);
+
+		private:
+			// log2(fftSize), or -1 if it is not a supported power of 2
+			static int Log2Size(size_t fftSize);
+		};
+	}
+}
+
+#endif // FFTPLANCACHE_H
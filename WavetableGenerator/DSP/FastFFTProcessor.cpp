@@ -0,0 +1,117 @@
+#include "FastFFTProcessor.h"
+#include "FFTPlanCache.h"
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+
+namespace WavetableGen {
+	namespace DSP {
+		FastFFTProcessor::FastFFTProcessor(int fftSize)
+			: FastFFTProcessor(fftSize, Utils::CpuFeatures::GetSimdLevel()) {
+		}
+
+		FastFFTProcessor::FastFFTProcessor(int fftSize, Utils::SimdLevel level)
+			: m_fftSize(0)
+			, m_forward(FFTKernels::Get(FFTDirection::Forward, level))
+			, m_inverse(FFTKernels::Get(FFTDirection::Inverse, level)) {
+			SetFFTSize(fftSize);
+		}
+
+		void FastFFTProcessor::SetFFTSize(int fftSize) {
+			if (fftSize == m_fftSize) return;
+
+			// Validate FFT size (must be power of 2)
+			if (fftSize < 2 || (fftSize & (fftSize - 1)) != 0) {
+				throw std::invalid_argument("FFT size must be a power of 2");
+			}
+
+			m_fftSize = fftSize;
+			m_complexBuffer.resize(m_fftSize / 2 + 1);
+		}
+
+		void FastFFTProcessor::Forward(const std::vector<float>& timeDomain,
+			std::vector<FrequencyBin>& frequencyDomain) {
+			Forward(timeDomain, m_complexBuffer);
+
+			// Convert to magnitude/phase representation
+			int numBins = m_fftSize / 2 + 1;
+			frequencyDomain.resize(numBins);
+			for (int i = 0; i < numBins; ++i) {
+				float real = m_complexBuffer[i].real();
+				float imag = m_complexBuffer[i].imag();
+				frequencyDomain[i].magnitude = std::sqrt(real * real + imag * imag);
+				frequencyDomain[i].phase = std::atan2(imag, real);
+			}
+		}
+
+		void FastFFTProcessor::Inverse(const std::vector<FrequencyBin>& frequencyDomain,
+			std::vector<float>& timeDomain) {
+			// Convert magnitude/phase back to complex representation
+			int numBins = static_cast<int>(frequencyDomain.size());
+			m_complexBuffer.resize(numBins);
+			for (int i = 0; i < numBins; ++i) {
+				float mag = frequencyDomain[i].magnitude;
+				float phase = frequencyDomain[i].phase;
+				m_complexBuffer[i] = ComplexBin(mag * std::cos(phase), mag * std::sin(phase));
+			}
+
+			Inverse(m_complexBuffer, timeDomain);
+		}
+
+		void FastFFTProcessor::Forward(const std::vector<float>& timeDomain,
+			std::vector<ComplexBin>& frequencyDomain) {
+			int inputSize = static_cast<int>(timeDomain.size());
+
+			// Ensure FFT is configured for this size
+			if (inputSize != m_fftSize) {
+				SetFFTSize(inputSize);
+			}
+
+			// N/2+1 bins written straight into the output as interleaved (re, im) floats
+			frequencyDomain.resize(m_fftSize / 2 + 1);
+			m_forward(FFTPlanCache::GetPlan(m_fftSize), timeDomain.data(), reinterpret_cast<float*>(frequencyDomain.data()));
+		}
+
+		void FastFFTProcessor::Inverse(const std::vector<ComplexBin>& frequencyDomain,
+			std::vector<float>& timeDomain) {
+			int numBins = static_cast<int>(frequencyDomain.size());
+			int expectedSize = (numBins - 1) * 2;
+
+			// Ensure FFT is configured for this size
+			if (expectedSize != m_fftSize) {
+				SetFFTSize(expectedSize);
+			}
+
+			timeDomain.resize(m_fftSize);
+			m_inverse(FFTPlanCache::GetPlan(m_fftSize), reinterpret_cast<const float*>(frequencyDomain.data()), timeDomain.data());
+		}
+
+		void FastFFTProcessor::ForwardBatch(const float* timeDomain, ComplexBin* frequencyDomain, size_t numFrames) {
+			size_t n = static_cast<size_t>(m_fftSize);
+			size_t numBins = n / 2 + 1;
+			RealFFTKernel kernel = m_forward;
+			// By reference: the captures do not fit std::function's inline storage, and copying
+			// them into it would allocate on every batch
+			auto body = [=](size_t first, size_t last) {
+				RealFFTPlan& plan = FFTPlanCache::GetPlan(n);
+				for (size_t f = first; f < last; ++f) {
+					kernel(plan, timeDomain + f * n, reinterpret_cast<float*>(frequencyDomain + f * numBins));
+				}
+			};
+			FFTPlanCache::ForEachFrameRange(numFrames, n, std::cref(body));
+		}
+
+		void FastFFTProcessor::InverseBatch(const ComplexBin* frequencyDomain, float* timeDomain, size_t numFrames) {
+			size_t n = static_cast<size_t>(m_fftSize);
+			size_t numBins = n / 2 + 1;
+			RealFFTKernel kernel = m_inverse;
+			auto body = [=](size_t first, size_t last) {
+				RealFFTPlan& plan = FFTPlanCache::GetPlan(n);
+				for (size_t f = first; f < last; ++f) {
+					kernel(plan, reinterpret_cast<const float*>(frequencyDomain + f * numBins), timeDomain + f * n);
+				}
+			};
+			FFTPlanCache::ForEachFrameRange(numFrames, n, std::cref(body));
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef FASTFFTPROCESSOR_H
+#define FASTFFTPROCESSOR_H
+
+#include "IFrequencyProcessor.h"
+#include "FFTKernels.h"
+#include <vector>
+
+namespace WavetableGen {
+	namespace DSP {
+		// Radix-4 SIMD real FFT (see FFTKernels)
+		// Same contract as KissFFTProcessor (power of 2 sizes, inverse scaled by 1/N), but the
+		// kernels are vectorized for the running CPU. The plans come from the calling thread's
+		// FFTPlanCache, so changing sizes does not reallocate them; the polar transforms use
+		// per-instance scratch.
+		class FastFFTProcessor : public IFrequencyProcessor {
+		public:
+			// Constructor with FFT size (must be power of 2)
+			explicit FastFFTProcessor(int fftSize = 2048);
+
+			// Kernels for a specific instruction set instead of the best one for the CPU
+			FastFFTProcessor(int fftSize, Utils::SimdLevel level);
+
+			// IFrequencyProcessor implementation
+			void Forward(const std::vector<float>& timeDomain,
+				std::vector<FrequencyBin>& frequencyDomain) override;
+
+			void Inverse(const std::vector<FrequencyBin>& frequencyDomain,
+				std::vector<float>& timeDomain) override;
+
+			void Forward(const std::vector<float>& timeDomain,
+				std::vector<ComplexBin>& frequencyDomain) override;
+
+			void Inverse(const std::vector<ComplexBin>& frequencyDomain,
+				std::vector<float>& timeDomain) override;
+
+			void ForwardBatch(const float* timeDomain, ComplexBin* frequencyDomain, size_t numFrames) override;
+
+			void InverseBatch(const ComplexBin* frequencyDomain, float* timeDomain, size_t numFrames) override;
+
+			int GetFFTSize() const override { return m_fftSize; }
+
+			void SetFFTSize(int fftSize) override;
+
+		private:
+			int m_fftSize;
+			RealFFTKernel m_forward;
+			RealFFTKernel m_inverse;
+
+			// Complex spectrum scratch for the polar transforms
+			std::vector<ComplexBin> m_complexBuffer;
+		};
+	}
+}
+
+#endif // FASTFFTPROCESSOR_H
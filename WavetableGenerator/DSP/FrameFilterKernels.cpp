@@ -0,0 +1,147 @@
+#include "FrameFilterKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		FrameFilter FrameFilter::Design(FilterType type, FilterMode mode, float cutoff, float resonance) {
+			FrameFilter f;
+			f.type = type;
+			f.mode = mode;
+
+			if (type == FilterType::OnePole) {
+				f.alpha = mode == FilterMode::LowPass ? cutoff : 1.0f - cutoff;
+				return f;
+			}
+
+			// Keep the two-pole designs away from DC and Nyquist, where they become unstable
+			const double pi = 3.14159265358979323846;
+			double w0 = pi * std::min(std::max((double)cutoff, 0.001), 0.999);
+			double q = std::max((double)resonance, 0.1);
+
+			if (type == FilterType::Biquad) {
+				// RBJ audio EQ cookbook
+				double cosW0 = std::cos(w0);
+				double alpha = std::sin(w0) / (2.0 * q);
+				double a0 = 1.0 + alpha;
+				double b0 = mode == FilterMode::LowPass ? (1.0 - cosW0) / 2.0 : (1.0 + cosW0) / 2.0;
+				double b1 = mode == FilterMode::LowPass ? 1.0 - cosW0 : -(1.0 + cosW0);
+				f.b0 = (float)(b0 / a0);
+				f.b1 = (float)(b1 / a0);
+				f.b2 = (float)(b0 / a0);
+				f.a1 = (float)(-2.0 * cosW0 / a0);
+				f.a2 = (float)((1.0 - alpha) / a0);
+			}
+			else {
+				// Trapezoidal (zero-delay feedback) state variable filter
+				double g = std::tan(w0 / 2.0);
+				double k = 1.0 / q;
+				double g1 = 1.0 / (1.0 + g * (g + k));
+				f.k = (float)k;
+				f.g1 = (float)g1;
+				f.g2 = (float)(g * g1);
+				f.g3 = (float)(g * g * g1);
+			}
+			return f;
+		}
+
+		FrameFilterKernel FrameFilterKernels::Get() {
+			return Get(Utils::CpuFeatures::GetSimdLevel());
+		}
+
+		FrameFilterKernel FrameFilterKernels::Get(Utils::SimdLevel level) {
+			FrameFilterKernel kernel = nullptr;
+
+			// Fall back to the next lower instruction set if a level was not compiled in
+			switch (level) {
+			case Utils::SimdLevel::AVX512:
+				kernel = GetAVX512();
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::AVX2:
+				kernel = GetAVX2();
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::SSE2:
+				kernel = GetSSE2();
+				break;
+			default:
+				break;
+			}
+
+			return kernel ? kernel : ProcessScalar;
+		}
+
+		float FrameFilterKernels::GetMaxError(FilterType type) {
+			switch (type) {
+			case FilterType::OnePole: return 5e-7f;
+			case FilterType::Biquad: return 3e-4f;
+			case FilterType::StateVariable: return 6e-6f;
+			default: return 0.0f;
+			}
+		}
+
+		void FrameFilterKernels::ProcessScalar(float* frames, size_t numFrames, size_t frameSize, const FrameFilter& f) {
+			if (frameSize == 0) return;
+
+			for (size_t frame = 0; frame < numFrames; ++frame) {
+				float* samples = frames + frame * frameSize;
+
+				switch (f.type) {
+				case FilterType::OnePole:
+					if (f.mode == FilterMode::LowPass) {
+						float prev = samples[0];
+						for (size_t i = 1; i < frameSize; ++i) {
+							samples[i] = prev + f.alpha * (samples[i] - prev);
+							prev = samples[i];
+						}
+					}
+					else {
+						float prevInput = samples[0];
+						float prevOutput = 0.0f;
+						for (size_t i = 1; i < frameSize; ++i) {
+							float input = samples[i];
+							float output = f.alpha * (prevOutput + input - prevInput);
+							samples[i] = output;
+							prevInput = input;
+							prevOutput = output;
+						}
+					}
+					break;
+
+				case FilterType::Biquad: {
+					// Start at rest on the first sample: the state a constant input would settle to
+					float x0 = samples[0];
+					float y0 = f.mode == FilterMode::LowPass ? x0 : 0.0f;
+					float s1 = y0 - f.b0 * x0;
+					float s2 = f.b2 * x0 - f.a2 * y0;
+					for (size_t i = 0; i < frameSize; ++i) {
+						float x = samples[i];
+						float y = f.b0 * x + s1;
+						s1 = f.b1 * x - f.a1 * y + s2;
+						s2 = f.b2 * x - f.a2 * y;
+						samples[i] = y;
+					}
+					break;
+				}
+
+				case FilterType::StateVariable: {
+					// At rest on the first sample: the low-pass integrator holds it, the band-pass one is empty
+					float ic1 = 0.0f;
+					float ic2 = samples[0];
+					for (size_t i = 0; i < frameSize; ++i) {
+						float x = samples[i];
+						float v3 = x - ic2;
+						float v1 = f.g1 * ic1 + f.g2 * v3;
+						float v2 = ic2 + f.g2 * ic1 + f.g3 * v3;
+						ic1 = 2.0f * v1 - ic1;
+						ic2 = 2.0f * v2 - ic2;
+						samples[i] = f.mode == FilterMode::LowPass ? v2 : x - f.k * v1 - v2;
+					}
+					break;
+				}
+				}
+			}
+		}
+	}
+}
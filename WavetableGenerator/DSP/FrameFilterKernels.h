@@ -0,0 +1,75 @@
+#ifndef FRAMEFILTERKERNELS_H
+#define FRAMEFILTERKERNELS_H
+
+#include "WaveformEffects.h"
+#include "../Utils/CpuFeatures.h"
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Core {
+		enum class FilterMode {
+			LowPass,
+			HighPass
+		};
+
+		// Coefficients of one low- or high-pass filter, designed once and shared by every frame
+		struct FrameFilter {
+			FilterType type = FilterType::OnePole;
+			FilterMode mode = FilterMode::LowPass;
+
+			// OnePole: smoothing factor (cutoff for low-pass, 1 - cutoff for high-pass)
+			float alpha = 1.0f;
+
+			// Biquad: normalized transposed direct form II coefficients (a0 = 1)
+			float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+
+			// StateVariable: damping k = 1/Q and the trapezoidal integrator gains
+			float k = 1.0f, g1 = 0.0f, g2 = 0.0f, g3 = 0.0f;
+
+			// cutoff: 0.0-1.0 (fraction of Nyquist), resonance: Q of the two-pole types
+			static FrameFilter Design(FilterType type, FilterMode mode, float cutoff, float resonance);
+		};
+
+		// Filter numFrames contiguous frames of frameSize samples in place
+		// Each frame is filtered independently from its own first sample: the one-pole filters
+		// leave sample 0 as is (like ApplyLowPassFilter/ApplyHighPassFilter), the two-pole filters
+		// start at rest on it
+		typedef void (*FrameFilterKernel)(float* frames, size_t numFrames, size_t frameSize, const FrameFilter& filter);
+
+		// Frame-batched recursive filters
+		// A recursive filter cannot be vectorized along a frame, so the SIMD kernels transpose
+		// V::Width frames into the lanes of a vector (in short chunks on the stack) and run the
+		// recurrence on all of them at once. Each lane performs the same operations as the scalar
+		// kernel, in the same order, so the output matches it up to FMA contraction (see
+		// GetMaxError). The instruction set is picked at runtime like FastWaveKernels.
+		class FrameFilterKernels {
+		public:
+			// Frames the widest compiled kernel filters together (batch at least this many)
+			static const size_t MAX_BATCH_FRAMES = 16;
+
+			// Best kernel for the running CPU
+			static FrameFilterKernel Get();
+
+			// Kernel for a specific instruction set (Scalar, or the next lower level that was compiled in)
+			static FrameFilterKernel Get(Utils::SimdLevel level);
+
+			// Reference kernel, one frame at a time
+			static void ProcessScalar(float* frames, size_t numFrames, size_t frameSize, const FrameFilter& filter);
+
+			// Largest difference of a SIMD kernel from ProcessScalar, relative to max(1, |output|),
+			// measured for cutoffs 0.01-0.99 and resonances 0.5-10 on inputs within [-2, 2], over
+			// every ISA with and without FMA contraction, with a 2x margin. Without contraction the
+			// kernels match ProcessScalar exactly. The biquad is the least well conditioned near DC:
+			// below a cutoff of 0.01 its difference grows past this bound (about 2e-3 at 0.001).
+			static float GetMaxError(FilterType type);
+
+		private:
+			// One entry point per instruction set (see FrameFilterKernelsSSE2/AVX2/AVX512.cpp)
+			static FrameFilterKernel GetSSE2();
+			static FrameFilterKernel GetAVX2();
+			static FrameFilterKernel GetAVX512();
+		};
+	}
+}
+
+#endif // FRAMEFILTERKERNELS_H
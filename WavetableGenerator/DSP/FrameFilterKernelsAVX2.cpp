@@ -0,0 +1,15 @@
+// Compiled with /arch:AVX2 (see WavetableGenerator.vcxproj)
+#include "FrameFilterKernels.h"
+#include "FrameFilterKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		FrameFilterKernel FrameFilterKernels::GetAVX2() {
+#if defined(WTG_HAS_AVX2)
+			return FrameFilterKernelsSimd<Utils::VecAVX2>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
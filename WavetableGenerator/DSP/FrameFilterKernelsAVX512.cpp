@@ -0,0 +1,15 @@
+// Compiled with /arch:AVX512 (see WavetableGenerator.vcxproj)
+#include "FrameFilterKernels.h"
+#include "FrameFilterKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		FrameFilterKernel FrameFilterKernels::GetAVX512() {
+#if defined(WTG_HAS_AVX512)
+			return FrameFilterKernelsSimd<Utils::VecAVX512>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
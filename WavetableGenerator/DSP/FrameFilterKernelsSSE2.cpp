@@ -0,0 +1,15 @@
+// SSE2 is the x64 baseline, so no extra /arch flag is needed
+#include "FrameFilterKernels.h"
+#include "FrameFilterKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		FrameFilterKernel FrameFilterKernels::GetSSE2() {
+#if defined(WTG_HAS_SSE2)
+			return FrameFilterKernelsSimd<Utils::VecSSE2>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,206 @@
+#ifndef FRAMEFILTERKERNELSSIMD_H
+#define FRAMEFILTERKERNELSSIMD_H
+
+// Instruction-set independent implementation of the frame-batched filter kernels.
+// Only include this from the per-ISA translation units (FrameFilterKernelsSSE2/AVX2/AVX512.cpp):
+// it is instantiated once per vector type from Utils/SimdVector.h.
+// Like the waveform kernel headers it uses no inline standard library functions.
+//
+// Lane k of every vector holds frame k of the batch. Each filter below performs the same
+// operations per lane, in the same order, as FrameFilterKernels::ProcessScalar; only FMA
+// contraction makes the lanes differ from it (see FrameFilterKernels::GetMaxError).
+// The transposition uses 4x4 SSE blocks, which every instruction set level includes.
+
+#include "FrameFilterKernels.h"
+#include "../Utils/SimdVector.h"
+#include <xmmintrin.h>
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			template <class V>
+			class FrameFilterKernelsSimd {
+				typedef typename V::Reg Reg;
+
+				// Samples per frame transposed at a time (CHUNK x Width floats on the stack)
+				static const size_t CHUNK = 64;
+
+			public:
+				static void Process(float* frames, size_t numFrames, size_t frameSize, const FrameFilter& f) {
+					if (frameSize == 0) return;
+
+					size_t frame = 0;
+					for (; frame + V::Width <= numFrames; frame += V::Width) {
+						ProcessBatch(frames + frame * frameSize, V::Width, frameSize, f);
+					}
+
+					// A single leftover frame is not worth the transposition
+					size_t remaining = numFrames - frame;
+					if (remaining > 1) {
+						ProcessBatch(frames + frame * frameSize, remaining, frameSize, f);
+					}
+					else if (remaining == 1) {
+						FrameFilterKernels::ProcessScalar(frames + frame * frameSize, 1, frameSize, f);
+					}
+				}
+
+			private:
+				struct OnePoleLowPass {
+					static const size_t FIRST = 1; // Sample 0 passes through
+					Reg alpha, prev;
+					OnePoleLowPass(const FrameFilter& f, Reg x0) : alpha(V::Set1(f.alpha)), prev(x0) {}
+					Reg Step(Reg x) {
+						prev = V::Add(prev, V::Mul(alpha, V::Sub(x, prev)));
+						return prev;
+					}
+				};
+
+				struct OnePoleHighPass {
+					static const size_t FIRST = 1;
+					Reg alpha, prevInput, prevOutput;
+					OnePoleHighPass(const FrameFilter& f, Reg x0) : alpha(V::Set1(f.alpha)), prevInput(x0), prevOutput(V::Set1(0.0f)) {}
+					Reg Step(Reg x) {
+						prevOutput = V::Mul(alpha, V::Sub(V::Add(prevOutput, x), prevInput));
+						prevInput = x;
+						return prevOutput;
+					}
+				};
+
+				struct Biquad {
+					static const size_t FIRST = 0;
+					Reg b0, b1, b2, a1, a2, s1, s2;
+					Biquad(const FrameFilter& f, Reg x0)
+						: b0(V::Set1(f.b0)), b1(V::Set1(f.b1)), b2(V::Set1(f.b2)), a1(V::Set1(f.a1)), a2(V::Set1(f.a2)) {
+						Reg y0 = f.mode == FilterMode::LowPass ? x0 : V::Set1(0.0f);
+						s1 = V::Sub(y0, V::Mul(b0, x0));
+						s2 = V::Sub(V::Mul(b2, x0), V::Mul(a2, y0));
+					}
+					Reg Step(Reg x) {
+						Reg y = V::Add(V::Mul(b0, x), s1);
+						s1 = V::Add(V::Sub(V::Mul(b1, x), V::Mul(a1, y)), s2);
+						s2 = V::Sub(V::Mul(b2, x), V::Mul(a2, y));
+						return y;
+					}
+				};
+
+				struct StateVariable {
+					static const size_t FIRST = 0;
+					bool lowPass;
+					Reg k, g1, g2, g3, two, ic1, ic2;
+					StateVariable(const FrameFilter& f, Reg x0)
+						: lowPass(f.mode == FilterMode::LowPass), k(V::Set1(f.k)), g1(V::Set1(f.g1)), g2(V::Set1(f.g2)), g3(V::Set1(f.g3)),
+						two(V::Set1(2.0f)), ic1(V::Set1(0.0f)), ic2(x0) {}
+					Reg Step(Reg x) {
+						Reg v3 = V::Sub(x, ic2);
+						Reg v1 = V::Add(V::Mul(g1, ic1), V::Mul(g2, v3));
+						Reg v2 = V::Add(V::Add(ic2, V::Mul(g2, ic1)), V::Mul(g3, v3));
+						ic1 = V::Sub(V::Mul(two, v1), ic1);
+						ic2 = V::Sub(V::Mul(two, v2), ic2);
+						return lowPass ? v2 : V::Sub(V::Sub(x, V::Mul(k, v1)), v2);
+					}
+				};
+
+				// Filter 'lanes' (<= Width) consecutive frames together
+				static void ProcessBatch(float* frames, size_t lanes, size_t frameSize, const FrameFilter& f) {
+					switch (f.type) {
+					case FilterType::OnePole:
+						if (f.mode == FilterMode::LowPass) Run<OnePoleLowPass>(frames, lanes, frameSize, f);
+						else Run<OnePoleHighPass>(frames, lanes, frameSize, f);
+						break;
+					case FilterType::Biquad:
+						Run<Biquad>(frames, lanes, frameSize, f);
+						break;
+					case FilterType::StateVariable:
+						Run<StateVariable>(frames, lanes, frameSize, f);
+						break;
+					}
+				}
+
+				template <class Filter>
+				static void Run(float* frames, size_t lanes, size_t frameSize, const FrameFilter& f) {
+					// Unused lanes filter zeros and are never written back
+					float block[CHUNK * V::Width] = {};
+
+					for (size_t lane = 0; lane < lanes; ++lane)
+						block[lane] = frames[lane * frameSize];
+					Filter filter(f, V::Load(block));
+
+					for (size_t start = Filter::FIRST; start < frameSize; start += CHUNK) {
+						size_t count = frameSize - start < CHUNK ? frameSize - start : CHUNK;
+
+						TransposeIn(frames + start, frameSize, lanes, count, block);
+						for (size_t j = 0; j < count; ++j) {
+							float* p = block + j * V::Width;
+							V::Store(p, filter.Step(V::Load(p)));
+						}
+						TransposeOut(block, lanes, count, frames + start, frameSize);
+					}
+				}
+
+				// block[j * Width + lane] = frames[lane * frameSize + j] for j < count
+				static void TransposeIn(const float* frames, size_t frameSize, size_t lanes, size_t count, float* block) {
+					size_t lane = 0;
+					for (; lane + 4 <= lanes; lane += 4) {
+						const float* r0 = frames + lane * frameSize;
+						const float* r1 = r0 + frameSize;
+						const float* r2 = r1 + frameSize;
+						const float* r3 = r2 + frameSize;
+						size_t j = 0;
+						for (; j + 4 <= count; j += 4) {
+							__m128 a = _mm_loadu_ps(r0 + j), b = _mm_loadu_ps(r1 + j);
+							__m128 c = _mm_loadu_ps(r2 + j), d = _mm_loadu_ps(r3 + j);
+							_MM_TRANSPOSE4_PS(a, b, c, d);
+							_mm_storeu_ps(block + j * V::Width + lane, a);
+							_mm_storeu_ps(block + (j + 1) * V::Width + lane, b);
+							_mm_storeu_ps(block + (j + 2) * V::Width + lane, c);
+							_mm_storeu_ps(block + (j + 3) * V::Width + lane, d);
+						}
+						for (; j < count; ++j) {
+							float* p = block + j * V::Width + lane;
+							p[0] = r0[j]; p[1] = r1[j]; p[2] = r2[j]; p[3] = r3[j];
+						}
+					}
+					for (; lane < lanes; ++lane) {
+						const float* src = frames + lane * frameSize;
+						for (size_t j = 0; j < count; ++j)
+							block[j * V::Width + lane] = src[j];
+					}
+				}
+
+				// The inverse of TransposeIn
+				static void TransposeOut(const float* block, size_t lanes, size_t count, float* frames, size_t frameSize) {
+					size_t lane = 0;
+					for (; lane + 4 <= lanes; lane += 4) {
+						float* r0 = frames + lane * frameSize;
+						float* r1 = r0 + frameSize;
+						float* r2 = r1 + frameSize;
+						float* r3 = r2 + frameSize;
+						size_t j = 0;
+						for (; j + 4 <= count; j += 4) {
+							__m128 a = _mm_loadu_ps(block + j * V::Width + lane);
+							__m128 b = _mm_loadu_ps(block + (j + 1) * V::Width + lane);
+							__m128 c = _mm_loadu_ps(block + (j + 2) * V::Width + lane);
+							__m128 d = _mm_loadu_ps(block + (j + 3) * V::Width + lane);
+							_MM_TRANSPOSE4_PS(a, b, c, d);
+							_mm_storeu_ps(r0 + j, a);
+							_mm_storeu_ps(r1 + j, b);
+							_mm_storeu_ps(r2 + j, c);
+							_mm_storeu_ps(r3 + j, d);
+						}
+						for (; j < count; ++j) {
+							const float* p = block + j * V::Width + lane;
+							r0[j] = p[0]; r1[j] = p[1]; r2[j] = p[2]; r3[j] = p[3];
+						}
+					}
+					for (; lane < lanes; ++lane) {
+						float* dst = frames + lane * frameSize;
+						for (size_t j = 0; j < count; ++j)
+							dst[j] = block[j * V::Width + lane];
+					}
+				}
+			};
+		}
+	}
+}
+
+#endif // FRAMEFILTERKERNELSSIMD_H
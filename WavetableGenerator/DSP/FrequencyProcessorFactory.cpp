@@ -0,0 +1,18 @@
+#include "FrequencyProcessorFactory.h"
+#include "KissFFTProcessor.h"
+#include "FastFFTProcessor.h"
+
+namespace WavetableGen {
+	namespace DSP {
+		std::unique_ptr<IFrequencyProcessor> FrequencyProcessorFactory::Create(int fftSize, FFTBackend backend) {
+			switch (backend) {
+			case FFTBackend::Kiss:
+				return std::make_unique<KissFFTProcessor>(fftSize);
+			case FFTBackend::Fast:
+				return std::make_unique<FastFFTProcessor>(fftSize);
+			default:
+				return std::make_unique<FastFFTProcessor>(fftSize);
+			}
+		}
+	}
+}
@@ -0,0 +1,22 @@
+#ifndef FREQUENCYPROCESSORFACTORY_H
+#define FREQUENCYPROCESSORFACTORY_H
+
+#include "IFrequencyProcessor.h"
+#include <memory>
+
+namespace WavetableGen {
+	namespace DSP {
+		enum class FFTBackend {
+			Kiss, // KissFFTProcessor: portable reference
+			Fast  // FastFFTProcessor: radix-4 SIMD kernels
+		};
+
+		// Factory to create a frequency processor for the chosen FFT backend
+		class FrequencyProcessorFactory {
+		public:
+			static std::unique_ptr<IFrequencyProcessor> Create(int fftSize, FFTBackend backend = FFTBackend::Fast);
+		};
+	}
+}
+
+#endif // FREQUENCYPROCESSORFACTORY_H
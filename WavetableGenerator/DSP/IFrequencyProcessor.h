@@ -1,6 +1,9 @@
 #ifndef IFREQUENCYPROCESSOR_H
 #define IFREQUENCYPROCESSOR_H
 
+#include <cmath>
+#include <complex>
+#include <cstddef>
 #include <vector>
 
 namespace WavetableGen {
@@ -14,6 +17,9 @@ namespace WavetableGen {
 			FrequencyBin(float mag, float ph) : magnitude(mag), phase(ph) {}
 		};
 
+		// A frequency bin in rectangular form (real, imaginary), as the FFT produces it
+		typedef std::complex<float> ComplexBin;
+
 		// Interface for frequency domain processing (Dependency Inversion Principle)
 		// Abstracts the FFT implementation details
 		class IFrequencyProcessor {
@@ -28,13 +34,65 @@ namespace WavetableGen {
 
 			// Transform frequency domain back to time domain
 			// Input: frequency bins
-			// Output: time domain samples
+			// Output: time domain samples (scaled by 1/N, so Inverse(Forward(x)) == x)
 			virtual void Inverse(const std::vector<FrequencyBin>& frequencyDomain,
 				std::vector<float>& timeDomain) = 0;
 
+			// Complex-domain variants: the FFT output as is, without the per-bin sqrt/atan2 (and
+			// cos/sin on the way back) of the polar form. Prefer these unless the phase is needed.
+			virtual void Forward(const std::vector<float>& timeDomain,
+				std::vector<ComplexBin>& frequencyDomain) = 0;
+
+			virtual void Inverse(const std::vector<ComplexBin>& frequencyDomain,
+				std::vector<float>& timeDomain) = 0;
+
+			// Batched transforms of numFrames contiguous frames of GetFFTSize() = N samples
+			// Frame f is at timeDomain + f * N, its spectrum at frequencyDomain + f * (N/2 + 1).
+			// One call for a whole table: no allocations, and large batches are split across the
+			// shared thread pool.
+			virtual void ForwardBatch(const float* timeDomain, ComplexBin* frequencyDomain, size_t numFrames) = 0;
+
+			virtual void InverseBatch(const ComplexBin* frequencyDomain, float* timeDomain, size_t numFrames) = 0;
+
 			// Get the FFT size this processor is configured for
 			virtual int GetFFTSize() const = 0;
+
+			// Reconfigure for a different FFT size (must be power of 2)
+			virtual void SetFFTSize(int fftSize) = 0;
 		};
+
+		// In-place bin processors over a half spectrum (DC at index 0)
+		// Templates rather than callbacks, so the per-bin work inlines into the loop
+
+		// bins[k] *= gain(k): a real gain scales the magnitude and keeps the phase
+		template <class Gain>
+		inline void ScaleBins(ComplexBin* bins, size_t numBins, Gain gain) {
+			for (size_t k = 0; k < numBins; ++k) {
+				bins[k] *= gain(k);
+			}
+		}
+
+		// processor(k, bins[k]) for every bin
+		template <class Processor>
+		inline void ProcessBins(ComplexBin* bins, size_t numBins, Processor processor) {
+			for (size_t k = 0; k < numBins; ++k) {
+				processor(k, bins[k]);
+			}
+		}
+
+		// processor(k, magnitude, phase) on the polar form of every bin, for the stages that need the
+		// phase (the only place the transcendental conversions are paid)
+		template <class Processor>
+		inline void ProcessPolarBins(ComplexBin* bins, size_t numBins, Processor processor) {
+			for (size_t k = 0; k < numBins; ++k) {
+				float real = bins[k].real();
+				float imag = bins[k].imag();
+				float magnitude = std::sqrt(real * real + imag * imag);
+				float phase = std::atan2(imag, real);
+				processor(k, magnitude, phase);
+				bins[k] = ComplexBin(magnitude * std::cos(phase), magnitude * std::sin(phase));
+			}
+		}
 	}
 }
 
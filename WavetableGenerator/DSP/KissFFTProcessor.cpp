@@ -1,60 +1,64 @@
 #include "KissFFTProcessor.h"
+#include "FFTPlanCache.h"
 #include "../../third_party/kiss_fft/kiss_fft.h"
 #include <cmath>
+#include <functional>
 #include <stdexcept>
 #include <algorithm>
 
 namespace WavetableGen {
 	namespace DSP {
 		KissFFTProcessor::KissFFTProcessor(int fftSize)
-			: m_fftSize(fftSize)
-			, m_fftForward(nullptr)
-			, m_fftInverse(nullptr) {
-			InitializeFFT();
+			: m_fftSize(0) {
+			SetFFTSize(fftSize);
 		}
 
-		KissFFTProcessor::~KissFFTProcessor() {
-			CleanupFFT();
-		}
-
-		void KissFFTProcessor::InitializeFFT() {
-			CleanupFFT();
+		void KissFFTProcessor::SetFFTSize(int fftSize) {
+			if (fftSize == m_fftSize) return;
 
 			// Validate FFT size (must be power of 2)
-			if (m_fftSize <= 0 || (m_fftSize & (m_fftSize - 1)) != 0) {
+			if (fftSize < 2 || (fftSize & (fftSize - 1)) != 0) {
 				throw std::invalid_argument("FFT size must be a power of 2");
 			}
 
-			// Allocate FFT configurations
-			m_fftForward = kiss_fftr_alloc(m_fftSize, 0, nullptr, nullptr);
-			m_fftInverse = kiss_fftr_alloc(m_fftSize, 1, nullptr, nullptr);
-
-			if (!m_fftForward || !m_fftInverse) {
-				CleanupFFT();
-				throw std::runtime_error("Failed to allocate FFT configuration");
-			}
+			m_fftSize = fftSize;
+			m_complexBuffer.resize(m_fftSize / 2 + 1);
 		}
 
-		void KissFFTProcessor::CleanupFFT() {
-			if (m_fftForward) {
-				kiss_fftr_free(m_fftForward);
-				m_fftForward = nullptr;
-			}
-			if (m_fftInverse) {
-				kiss_fftr_free(m_fftInverse);
-				m_fftInverse = nullptr;
+		void KissFFTProcessor::Forward(const std::vector<float>& timeDomain,
+			std::vector<FrequencyBin>& frequencyDomain) {
+			Forward(timeDomain, m_complexBuffer);
+
+			// Convert to magnitude/phase representation
+			int numBins = m_fftSize / 2 + 1;
+			frequencyDomain.resize(numBins);
+			for (int i = 0; i < numBins; ++i) {
+				float real = m_complexBuffer[i].real();
+				float imag = m_complexBuffer[i].imag();
+
+				// Calculate magnitude and phase
+				frequencyDomain[i].magnitude = std::sqrt(real * real + imag * imag);
+				frequencyDomain[i].phase = std::atan2(imag, real);
 			}
 		}
 
-		void KissFFTProcessor::SetFFTSize(int fftSize) {
-			if (fftSize != m_fftSize) {
-				m_fftSize = fftSize;
-				InitializeFFT();
+		void KissFFTProcessor::Inverse(const std::vector<FrequencyBin>& frequencyDomain,
+			std::vector<float>& timeDomain) {
+			// Convert magnitude/phase back to complex representation
+			int numBins = static_cast<int>(frequencyDomain.size());
+			m_complexBuffer.resize(numBins);
+			for (int i = 0; i < numBins; ++i) {
+				float mag = frequencyDomain[i].magnitude;
+				float phase = frequencyDomain[i].phase;
+
+				m_complexBuffer[i] = ComplexBin(mag * std::cos(phase), mag * std::sin(phase));
 			}
+
+			Inverse(m_complexBuffer, timeDomain);
 		}
 
 		void KissFFTProcessor::Forward(const std::vector<float>& timeDomain,
-			std::vector<FrequencyBin>& frequencyDomain) {
+			std::vector<ComplexBin>& frequencyDomain) {
 			int inputSize = static_cast<int>(timeDomain.size());
 
 			// Ensure FFT is configured for this size
@@ -62,26 +66,14 @@ namespace WavetableGen {
 				SetFFTSize(inputSize);
 			}
 
-			// Allocate complex output (real FFT produces N/2+1 complex bins)
-			int numBins = m_fftSize / 2 + 1;
-			std::vector<kiss_fft_cpx> fftOutput(numBins);
-
-			// Perform forward FFT
-			kiss_fftr(m_fftForward, timeDomain.data(), fftOutput.data());
-
-			// Convert to magnitude/phase representation
-			frequencyDomain.resize(numBins);
-			for (int i = 0; i < numBins; ++i) {
-				float real = fftOutput[i].r;
-				float imag = fftOutput[i].i;
-
-				// Calculate magnitude and phase
-				frequencyDomain[i].magnitude = std::sqrt(real * real + imag * imag);
-				frequencyDomain[i].phase = std::atan2(imag, real);
-			}
+			// Real FFT produces N/2+1 complex bins, written straight into the output
+			// (std::complex<float> has the same layout as kiss_fft_cpx)
+			frequencyDomain.resize(m_fftSize / 2 + 1);
+			kiss_fftr_cfg plan = FFTPlanCache::GetKissPlan(m_fftSize, FFTDirection::Forward);
+			kiss_fftr(plan, timeDomain.data(), reinterpret_cast<kiss_fft_cpx*>(frequencyDomain.data()));
 		}
 
-		void KissFFTProcessor::Inverse(const std::vector<FrequencyBin>& frequencyDomain,
+		void KissFFTProcessor::Inverse(const std::vector<ComplexBin>& frequencyDomain,
 			std::vector<float>& timeDomain) {
 			int numBins = static_cast<int>(frequencyDomain.size());
 			int expectedSize = (numBins - 1) * 2;
@@ -91,21 +83,38 @@ namespace WavetableGen {
 				SetFFTSize(expectedSize);
 			}
 
-			// Convert magnitude/phase back to complex representation
-			std::vector<kiss_fft_cpx> fftInput(numBins);
-			for (int i = 0; i < numBins; ++i) {
-				float mag = frequencyDomain[i].magnitude;
-				float phase = frequencyDomain[i].phase;
-
-				fftInput[i].r = mag * std::cos(phase);
-				fftInput[i].i = mag * std::sin(phase);
-			}
-
 			// Allocate output buffer
 			timeDomain.resize(m_fftSize);
 
 			// Perform inverse FFT
-			kiss_fftri(m_fftInverse, fftInput.data(), timeDomain.data());
+			kiss_fftr_cfg plan = FFTPlanCache::GetKissPlan(m_fftSize, FFTDirection::Inverse);
+			kiss_fftri(plan, reinterpret_cast<const kiss_fft_cpx*>(frequencyDomain.data()), timeDomain.data());
+		}
+
+		void KissFFTProcessor::ForwardBatch(const float* timeDomain, ComplexBin* frequencyDomain, size_t numFrames) {
+			size_t n = static_cast<size_t>(m_fftSize);
+			size_t numBins = n / 2 + 1;
+			// By reference: the captures do not fit std::function's inline storage, and copying
+			// them into it would allocate on every batch
+			auto body = [=](size_t first, size_t last) {
+				kiss_fftr_cfg plan = FFTPlanCache::GetKissPlan(n, FFTDirection::Forward);
+				for (size_t f = first; f < last; ++f) {
+					kiss_fftr(plan, timeDomain + f * n, reinterpret_cast<kiss_fft_cpx*>(frequencyDomain + f * numBins));
+				}
+			};
+			FFTPlanCache::ForEachFrameRange(numFrames, n, std::cref(body));
+		}
+
+		void KissFFTProcessor::InverseBatch(const ComplexBin* frequencyDomain, float* timeDomain, size_t numFrames) {
+			size_t n = static_cast<size_t>(m_fftSize);
+			size_t numBins = n / 2 + 1;
+			auto body = [=](size_t first, size_t last) {
+				kiss_fftr_cfg plan = FFTPlanCache::GetKissPlan(n, FFTDirection::Inverse);
+				for (size_t f = first; f < last; ++f) {
+					kiss_fftri(plan, reinterpret_cast<const kiss_fft_cpx*>(frequencyDomain + f * numBins), timeDomain + f * n);
+				}
+			};
+			FFTPlanCache::ForEachFrameRange(numFrames, n, std::cref(body));
 		}
 	}
 }
\ No newline at end of file
@@ -2,21 +2,18 @@
 #define KISSFFTPROCESSOR_H
 
 #include "IFrequencyProcessor.h"
-#include <memory>
-
-// Forward declarations to avoid exposing KissFFT in header
-struct kiss_fftr_state;
-typedef struct kiss_fftr_state* kiss_fftr_cfg;
+#include <vector>
 
 namespace WavetableGen {
 	namespace DSP {
 		// KissFFT wrapper implementation (Single Responsibility Principle)
 		// Encapsulates all KissFFT-specific details
+		// The plans come from the calling thread's FFTPlanCache, so changing sizes does not
+		// reallocate them; the polar transforms use per-instance scratch
 		class KissFFTProcessor : public IFrequencyProcessor {
 		public:
 			// Constructor with FFT size (must be power of 2)
 			explicit KissFFTProcessor(int fftSize = 2048);
-			~KissFFTProcessor() override;
 
 			// IFrequencyProcessor implementation
 			void Forward(const std::vector<float>& timeDomain,
@@ -25,18 +22,26 @@ namespace WavetableGen {
 			void Inverse(const std::vector<FrequencyBin>& frequencyDomain,
 				std::vector<float>& timeDomain) override;
 
+			void Forward(const std::vector<float>& timeDomain,
+				std::vector<ComplexBin>& frequencyDomain) override;
+
+			void Inverse(const std::vector<ComplexBin>& frequencyDomain,
+				std::vector<float>& timeDomain) override;
+
+			void ForwardBatch(const float* timeDomain, ComplexBin* frequencyDomain, size_t numFrames) override;
+
+			void InverseBatch(const ComplexBin* frequencyDomain, float* timeDomain, size_t numFrames) override;
+
 			int GetFFTSize() const override { return m_fftSize; }
 
-			// Reconfigure for different FFT size
-			void SetFFTSize(int fftSize);
+			void SetFFTSize(int fftSize) override;
 
 		private:
-			void InitializeFFT();
-			void CleanupFFT();
-
 			int m_fftSize;
-			kiss_fftr_cfg m_fftForward;
-			kiss_fftr_cfg m_fftInverse;
+
+			// Complex spectrum scratch for the polar transforms, sized with the FFT so transforms
+			// of the configured size do not allocate
+			std::vector<ComplexBin> m_complexBuffer;
 		};
 	}
 }
@@ -0,0 +1,132 @@
+#include "Oversampler.h"
+#include <stdexcept>
+
+namespace WavetableGen {
+	namespace DSP {
+		namespace {
+			// Odd taps h[1], h[3], ... of a 47-tap equiripple half-band (passband 0.2, stopband 0.3 of
+			// the high rate). Used next to the base rate, where the content reaches its Nyquist.
+			const float STEEP_TAPS[] = {
+				3.164571530e-01f, -1.006567014e-01f, 5.494390777e-02f, -3.397873223e-02f,
+				2.171184271e-02f, -1.378709492e-02f, 8.498242686e-03f, -4.987050923e-03f,
+				2.728362087e-03f, -1.351457211e-03f, 5.764333790e-04f, -1.977007640e-04f
+			};
+
+			// Odd taps of a 15-tap equiripple half-band (passband 0.1, stopband 0.4 of the high rate)
+			const float WIDE_TAPS[] = {
+				3.031606083e-01f, -6.765733186e-02f, 1.694900911e-02f, -2.468027222e-03f
+			};
+
+			const int MAX_STAGES = 3;
+
+			// Sample i of a length-n signal that is zero outside [0, n)
+			inline float SampleAt(const float* x, ptrdiff_t i, size_t n) {
+				return (i >= 0 && i < (ptrdiff_t)n) ? x[i] : 0.0f;
+			}
+		}
+
+		Oversampler::Oversampler(int factor)
+			: m_factor(factor)
+			, m_numStages(0) {
+			if (factor != 1 && factor != 2 && factor != 4 && factor != 8) {
+				throw std::invalid_argument("Oversampling factor must be 1, 2, 4 or 8");
+			}
+			while ((1 << m_numStages) < factor) {
+				++m_numStages;
+			}
+		}
+
+		const Oversampler::HalfBand& Oversampler::GetStage(int stage) {
+			static const HalfBand steep = { STEEP_TAPS, (int)(sizeof(STEEP_TAPS) / sizeof(STEEP_TAPS[0])) };
+			static const HalfBand wide = { WIDE_TAPS, (int)(sizeof(WIDE_TAPS) / sizeof(WIDE_TAPS[0])) };
+			return stage == 0 ? steep : wide;
+		}
+
+		size_t Oversampler::GetScratchSize(size_t numSamples) const {
+			// Intermediate rates ping-pong between two regions: A holds factor/2 x, B factor/4 x
+			if (m_numStages < 2) return 0;
+			size_t size = numSamples * (size_t)(m_factor / 2);
+			if (m_numStages > 2) size += numSamples * (size_t)(m_factor / 4);
+			return size;
+		}
+
+		void Oversampler::Upsample(const float* input, size_t numSamples, float* output, float* scratch) const {
+			if (m_numStages == 0) {
+				for (size_t i = 0; i < numSamples; ++i) output[i] = input[i];
+				return;
+			}
+
+			float* regions[2] = { scratch, scratch + numSamples * (size_t)(m_factor / 2) };
+			const float* in = input;
+			size_t n = numSamples;
+			for (int s = 0; s < m_numStages; ++s) {
+				float* out = (s == m_numStages - 1) ? output : regions[(m_numStages - 2 - s) % 2];
+				Interpolate2x(GetStage(s), in, n, out);
+				in = out;
+				n *= 2;
+			}
+		}
+
+		void Oversampler::Downsample(const float* input, size_t numSamples, float* output, float* scratch) const {
+			if (m_numStages == 0) {
+				for (size_t i = 0; i < numSamples; ++i) output[i] = input[i];
+				return;
+			}
+
+			float* regions[2] = { scratch, scratch + numSamples * (size_t)(m_factor / 2) };
+			const float* in = input;
+			for (int s = m_numStages - 1; s >= 0; --s) {
+				float* out = (s == 0) ? output : regions[(m_numStages - 1 - s) % 2];
+				Decimate2x(GetStage(s), in, numSamples << s, out);
+				in = out;
+			}
+		}
+
+		void Oversampler::Interpolate2x(const HalfBand& filter, const float* in, size_t n, float* out) {
+			// Even outputs are the input samples (center tap); odd outputs are the symmetric odd taps
+			// applied to the input pairs around them, times 2 to keep unity passband gain
+			const float* taps = filter.taps;
+			const int numTaps = filter.numTaps;
+
+			for (size_t m = 0; m < n; ++m) {
+				float sum = 0.0f;
+				if (m + 1 >= (size_t)numTaps && m + numTaps < n) {
+					for (int k = 0; k < numTaps; ++k) {
+						sum += taps[k] * (in[m - k] + in[m + 1 + k]);
+					}
+				}
+				else {
+					for (int k = 0; k < numTaps; ++k) {
+						sum += taps[k] * (SampleAt(in, (ptrdiff_t)m - k, n) + SampleAt(in, (ptrdiff_t)m + 1 + k, n));
+					}
+				}
+				out[2 * m] = in[m];
+				out[2 * m + 1] = 2.0f * sum;
+			}
+		}
+
+		void Oversampler::Decimate2x(const HalfBand& filter, const float* in, size_t n, float* out) {
+			// Only the kept (even) outputs are computed: center tap plus the odd taps around it
+			const float* taps = filter.taps;
+			const int numTaps = filter.numTaps;
+			const size_t inSize = 2 * n;
+
+			for (size_t m = 0; m < n; ++m) {
+				const size_t center = 2 * m;
+				float sum = 0.0f;
+				if (center + 1 >= (size_t)(2 * numTaps) && center + 2 * numTaps <= inSize) {
+					for (int k = 0; k < numTaps; ++k) {
+						sum += taps[k] * (in[center - 1 - 2 * k] + in[center + 1 + 2 * k]);
+					}
+				}
+				else {
+					for (int k = 0; k < numTaps; ++k) {
+						sum += taps[k] * (SampleAt(in, (ptrdiff_t)center - 1 - 2 * k, inSize) +
+							SampleAt(in, (ptrdiff_t)center + 1 + 2 * k, inSize));
+					}
+				}
+				out[m] = 0.5f * in[center] + sum;
+			}
+		}
+	}
+}
@@ -0,0 +1,74 @@
+#include "PeriodicResampler.h"
+#include "FFTPlanCache.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace WavetableGen {
+	namespace DSP {
+		PeriodicResampler::PeriodicResampler(size_t numSamples, int factor)
+			: m_numSamples(numSamples)
+			, m_factor(factor)
+			, m_forward(FFTKernels::Get(FFTDirection::Forward))
+			, m_inverse(FFTKernels::Get(FFTDirection::Inverse)) {
+			if (factor != 1 && factor != 2 && factor != 4 && factor != 8) {
+				throw std::invalid_argument("Oversampling factor must be 1, 2, 4 or 8");
+			}
+			if (numSamples < 2 || (numSamples & (numSamples - 1)) != 0) {
+				throw std::invalid_argument("Period length must be a power of 2");
+			}
+			if (factor == 1) return;
+
+			size_t highSize = numSamples * (size_t)factor;
+			m_spectrum.resize((highSize / 2 + 1) * 2);
+		}
+
+		void PeriodicResampler::Upsample(const float* input, float* output) {
+			if (m_factor == 1) {
+				std::copy(input, input + m_numSamples, output);
+				return;
+			}
+
+			float* spectrum = m_spectrum.data();
+			size_t half = m_numSamples / 2;
+			size_t highBins = half * (size_t)m_factor + 1;
+
+			m_forward(FFTPlanCache::GetPlan(m_numSamples), input, spectrum);
+
+			// The inverse is scaled by 1/(numSamples * factor): compensate so amplitudes are kept.
+			// The base-rate Nyquist bin stands for both +N/2 and -N/2, which are distinct bins at
+			// the high rate: split it between them (the inverse mirrors the upper half)
+			float gain = (float)m_factor;
+			for (size_t i = 0; i < 2 * half; ++i) {
+				spectrum[i] *= gain;
+			}
+			spectrum[2 * half] *= gain * 0.5f;
+			spectrum[2 * half + 1] = 0.0f;
+			std::fill(spectrum + 2 * (half + 1), spectrum + 2 * highBins, 0.0f);
+
+			m_inverse(FFTPlanCache::GetPlan(m_numSamples * m_factor), spectrum, output);
+		}
+
+		void PeriodicResampler::Downsample(const float* input, float* output) {
+			if (m_factor == 1) {
+				std::copy(input, input + m_numSamples, output);
+				return;
+			}
+
+			float* spectrum = m_spectrum.data();
+			size_t half = m_numSamples / 2;
+
+			m_forward(FFTPlanCache::GetPlan(m_numSamples * m_factor), input, spectrum);
+
+			// Keep the bins the base rate can represent; at its Nyquist the +N/2 and -N/2 bins
+			// fold together (the inverse of the split in Upsample)
+			float gain = 1.0f / (float)m_factor;
+			for (size_t i = 0; i < 2 * half; ++i) {
+				spectrum[i] *= gain;
+			}
+			spectrum[2 * half] *= 2.0f * gain;
+			spectrum[2 * half + 1] = 0.0f;
+
+			m_inverse(FFTPlanCache::GetPlan(m_numSamples), spectrum, output);
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#ifndef PERIODICRESAMPLER_H
+#define PERIODICRESAMPLER_H
+
+#include "FFTKernels.h"
+#include <cstddef>
+#include <vector>
+
+namespace WavetableGen {
+	namespace DSP {
+		// Band-limited up/down sampler for exactly one period (Single Responsibility Principle)
+		// A wavetable frame is one cycle of a periodic signal, so resampling can be done on its
+		// spectrum: Upsample zero-pads the numSamples-point real FFT to numSamples * factor points,
+		// Downsample keeps the bins below the base-rate Nyquist and discards the rest.
+		// Unlike Oversampler there are no edge transients, no passband ripple and no transition band:
+		// a band-limited cycle is reproduced exactly, and Downsample(Upsample(x)) == x.
+		// The FFT plans come from the calling thread's FFTPlanCache; the spectrum scratch belongs to
+		// the instance, so one instance must not be shared between threads.
+		class PeriodicResampler {
+		public:
+			// numSamples: period length (power of 2), factor: 1 (pass-through), 2, 4 or 8
+			explicit PeriodicResampler(size_t numSamples, int factor = 4);
+
+			PeriodicResampler(const PeriodicResampler&) = delete;
+			PeriodicResampler& operator=(const PeriodicResampler&) = delete;
+
+			size_t GetNumSamples() const { return m_numSamples; }
+			int GetFactor() const { return m_factor; }
+
+			// input: numSamples floats, output: numSamples * factor floats (may not overlap)
+			void Upsample(const float* input, float* output);
+
+			// input: numSamples * factor floats, output: numSamples floats (may not overlap)
+			void Downsample(const float* input, float* output);
+
+		private:
+			size_t m_numSamples;
+			int m_factor;
+			RealFFTKernel m_forward;
+			RealFFTKernel m_inverse;
+
+			// Complex spectrum at the high rate (numSamples * factor / 2 + 1 re/im pairs)
+			std::vector<float> m_spectrum;
+		};
+	}
+}
+
+#endif // PERIODICRESAMPLER_H
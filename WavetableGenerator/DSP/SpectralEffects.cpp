@@ -2,7 +2,7 @@
 #include <cmath>
 #include <algorithm>
 #include <stdexcept>
-#include <random>
+#include "../Utils/XorShift128Plus.h"
 
 namespace WavetableGen {
 	namespace Core {
@@ -11,6 +11,14 @@ namespace WavetableGen {
 			if (!m_fftProcessor) {
 				throw std::invalid_argument("FFT processor cannot be null");
 			}
+
+			Reserve(1, static_cast<size_t>(m_fftProcessor->GetFFTSize()));
+		}
+
+		void SpectralEffects::Reserve(size_t numFrames, size_t frameSize) {
+			size_t paddedSize = static_cast<size_t>(GetPaddedSize(static_cast<int>(frameSize)));
+			m_paddedSamples.reserve(numFrames * paddedSize);
+			m_frequencyDomain.reserve(numFrames * (paddedSize / 2 + 1));
 		}
 
 		int SpectralEffects::GetPaddedSize(int size) const {
@@ -22,174 +30,221 @@ namespace WavetableGen {
 			return padded;
 		}
 
-		void SpectralEffects::ProcessInFrequencyDomain(
-			std::vector<float>& samples,
-			std::function<void(std::vector<DSP::FrequencyBin>&, int)> processor) {
-			if (samples.empty()) return;
-
-			int originalSize = static_cast<int>(samples.size());
-			int paddedSize = GetPaddedSize(originalSize);
+		void SpectralEffects::ApplyStages(float* samples, size_t numSamples,
+			const SpectralStage* stages, size_t numStages, uint64_t seed) {
+			ApplyStagesBatch(samples, 1, numSamples, stages, numStages, &seed);
+		}
 
-			// Pad to power of 2 if necessary
-			std::vector<float> paddedSamples = samples;
-			if (paddedSize > originalSize) {
-				paddedSamples.resize(paddedSize, 0.0f);
+		void SpectralEffects::ApplyStagesBatch(float* frames, size_t numFrames, size_t frameSize,
+			const SpectralStage* stages, size_t numStages, const uint64_t* seeds) {
+			if (numFrames == 0 || frameSize == 0 || numStages == 0) return;
+
+			size_t paddedSize = static_cast<size_t>(GetPaddedSize(static_cast<int>(frameSize)));
+			size_t numBins = paddedSize / 2 + 1;
+			m_fftProcessor->SetFFTSize(static_cast<int>(paddedSize));
+
+			// Pad every frame to a power of 2 if necessary
+			m_paddedSamples.resize(numFrames * paddedSize);
+			m_frequencyDomain.resize(numFrames * numBins);
+			for (size_t f = 0; f < numFrames; ++f) {
+				float* padded = m_paddedSamples.data() + f * paddedSize;
+				std::copy(frames + f * frameSize, frames + (f + 1) * frameSize, padded);
+				std::fill(padded + frameSize, padded + paddedSize, 0.0f);
 			}
 
-			// Reconfigure FFT if size changed
-			if (paddedSize != m_fftProcessor->GetFFTSize()) {
-				std::vector<DSP::FrequencyBin> dummyOutput;
-				m_fftProcessor->Forward(paddedSamples, dummyOutput);
+			// Forward FFT of all frames
+			m_fftProcessor->ForwardBatch(m_paddedSamples.data(), m_frequencyDomain.data(), numFrames);
+
+			// Apply every bin operation in order on each frame's spectrum
+			for (size_t f = 0; f < numFrames; ++f) {
+				DSP::ComplexBin* bins = m_frequencyDomain.data() + f * numBins;
+				for (size_t s = 0; s < numStages; ++s) {
+					const SpectralStage& stage = stages[s];
+					switch (stage.operation) {
+					case SpectralOperation::Decay:
+						DecayBins(bins, numBins, stage.amount, stage.curve);
+						break;
+					case SpectralOperation::Tilt:
+						TiltBins(bins, numBins, stage.amount);
+						break;
+					case SpectralOperation::Gate:
+						GateBins(bins, numBins, stage.amount);
+						break;
+					case SpectralOperation::PhaseRandomize:
+						RandomizePhaseBins(bins, numBins, stage.amount, seeds[f]);
+						break;
+					case SpectralOperation::Shift:
+						ShiftBins(bins, numBins, stage.shiftAmount);
+						break;
+					}
+				}
 			}
 
-			// Forward FFT
-			std::vector<DSP::FrequencyBin> frequencyDomain;
-			m_fftProcessor->Forward(paddedSamples, frequencyDomain);
-
-			// Apply frequency domain processing
-			processor(frequencyDomain, paddedSize);
+			// Inverse FFT of all frames, back into the padded buffer
+			m_fftProcessor->InverseBatch(m_frequencyDomain.data(), m_paddedSamples.data(), numFrames);
 
-			// Inverse FFT
-			std::vector<float> output;
-			m_fftProcessor->Inverse(frequencyDomain, output);
+			for (size_t f = 0; f < numFrames; ++f) {
+				// Copy back original size (remove padding)
+				float* samples = frames + f * frameSize;
+				const float* padded = m_paddedSamples.data() + f * paddedSize;
+				std::copy(padded, padded + frameSize, samples);
 
-			// Copy back original size (remove padding)
-			samples.resize(originalSize);
-			for (int i = 0; i < originalSize; ++i) {
-				samples[i] = output[i];
-			}
-
-			// Normalize to prevent clipping from FFT round-trip
-			float maxVal = 0.0f;
-			for (float s : samples) {
-				maxVal = std::max(maxVal, std::abs(s));
-			}
-			if (maxVal > 1.0f) {
-				float scale = 1.0f / maxVal;
-				for (float& s : samples) {
-					s *= scale;
+				// Normalize to prevent clipping from FFT round-trip
+				float maxVal = 0.0f;
+				for (size_t i = 0; i < frameSize; ++i) {
+					maxVal = std::max(maxVal, std::abs(samples[i]));
+				}
+				if (maxVal > 1.0f) {
+					float scale = 1.0f / maxVal;
+					for (size_t i = 0; i < frameSize; ++i) {
+						samples[i] *= scale;
+					}
 				}
 			}
 		}
 
+		void SpectralEffects::ApplySingleStage(float* samples, size_t numSamples, SpectralOperation operation,
+			float amount, float curve, int shiftAmount, uint64_t seed) {
+			SpectralStage stage;
+			stage.operation = operation;
+			stage.amount = amount;
+			stage.curve = curve;
+			stage.shiftAmount = shiftAmount;
+			ApplyStages(samples, numSamples, &stage, 1, seed);
+		}
+
 		void SpectralEffects::ApplySpectralDecay(std::vector<float>& samples,
 			float amount, float curve) {
-			if (amount < 0.001f) return; // Skip if amount is negligible
-
-			ProcessInFrequencyDomain(samples,
-				[amount, curve](std::vector<DSP::FrequencyBin>& bins, int fftSize) {
-					int numBins = static_cast<int>(bins.size());
-
-					// Apply decay curve to each frequency bin
-					for (int i = 0; i < numBins; ++i) {
-						// Normalized frequency (0.0 to 1.0)
-						float freq = static_cast<float>(i) / static_cast<float>(numBins - 1);
+			ApplySpectralDecay(samples.data(), samples.size(), amount, curve);
+		}
 
-						// Calculate decay factor using power curve
-						// Higher frequencies decay more
-						float decay = 1.0f - (amount * std::pow(freq, curve));
-						decay = std::max(0.0f, std::min(1.0f, decay));
+		void SpectralEffects::ApplySpectralDecay(float* samples, size_t numSamples,
+			float amount, float curve) {
+			if (amount < 0.001f) return; // Skip if amount is negligible
 
-						// Apply decay to magnitude
-						bins[i].magnitude *= decay;
-					}
-				});
+			ApplySingleStage(samples, numSamples, SpectralOperation::Decay, amount, curve, 0, 0);
 		}
 
 		void SpectralEffects::ApplySpectralTilt(std::vector<float>& samples, float amount) {
-			if (std::abs(amount) < 0.001f) return;
-
-			ProcessInFrequencyDomain(samples,
-				[amount](std::vector<DSP::FrequencyBin>& bins, int fftSize) {
-					int numBins = static_cast<int>(bins.size());
-
-					for (int i = 0; i < numBins; ++i) {
-						// Normalized frequency (0.0 to 1.0)
-						float freq = static_cast<float>(i) / static_cast<float>(numBins - 1);
+			ApplySpectralTilt(samples.data(), samples.size(), amount);
+		}
 
-						// Linear tilt: -6dB/octave to +6dB/octave
-						float tilt = 1.0f + (amount * (freq - 0.5f) * 2.0f);
-						tilt = std::max(0.0f, std::min(2.0f, tilt));
+		void SpectralEffects::ApplySpectralTilt(float* samples, size_t numSamples, float amount) {
+			if (std::abs(amount) < 0.001f) return;
 
-						bins[i].magnitude *= tilt;
-					}
-				});
+			ApplySingleStage(samples, numSamples, SpectralOperation::Tilt, amount, 0.0f, 0, 0);
 		}
 
 		void SpectralEffects::ApplySpectralGate(std::vector<float>& samples, float threshold) {
-			if (threshold < 0.001f) return;
+			ApplySpectralGate(samples.data(), samples.size(), threshold);
+		}
 
-			ProcessInFrequencyDomain(samples,
-				[threshold](std::vector<DSP::FrequencyBin>& bins, int fftSize) {
-					// Find maximum magnitude
-					float maxMag = 0.0f;
-					for (const auto& bin : bins) {
-						maxMag = std::max(maxMag, bin.magnitude);
-					}
+		void SpectralEffects::ApplySpectralGate(float* samples, size_t numSamples, float threshold) {
+			if (threshold < 0.001f) return;
 
-					// Apply gate
-					float gateThreshold = maxMag * threshold;
-					for (auto& bin : bins) {
-						if (bin.magnitude < gateThreshold) {
-							bin.magnitude = 0.0f;
-						}
-					}
-				});
+			ApplySingleStage(samples, numSamples, SpectralOperation::Gate, threshold, 0.0f, 0, 0);
 		}
-		
+
 		void SpectralEffects::ApplySpectralShift(std::vector<float>& samples, int shiftAmount) {
+			ApplySpectralShift(samples.data(), samples.size(), shiftAmount);
+		}
+
+		void SpectralEffects::ApplySpectralShift(float* samples, size_t numSamples, int shiftAmount) {
 			if (shiftAmount == 0) return;
 
-			ProcessInFrequencyDomain(samples,
-				[shiftAmount](std::vector<DSP::FrequencyBin>& bins, int fftSize) {
-					int numBins = static_cast<int>(bins.size());
-					std::vector<DSP::FrequencyBin> shiftedBins(numBins);
+			ApplySingleStage(samples, numSamples, SpectralOperation::Shift, 0.0f, 0.0f, shiftAmount, 0);
+		}
 
-					// Initialize with silence
-					for (int i = 0; i < numBins; ++i) {
-						shiftedBins[i] = { 0.0f, 0.0f };
-					}
+		void SpectralEffects::ApplyPhaseRandomization(std::vector<float>& samples, float amount, uint64_t seed) {
+			ApplyPhaseRandomization(samples.data(), samples.size(), amount, seed);
+		}
 
-					// DC component (index 0) stays at 0
-					shiftedBins[0] = bins[0];
+		void SpectralEffects::ApplyPhaseRandomization(float* samples, size_t numSamples, float amount, uint64_t seed) {
+			if (amount < 0.001f) return;
 
-					// Shift other bins
-					for (int i = 1; i < numBins; ++i) {
-						int newIndex = i + shiftAmount;
-						if (newIndex >= 1 && newIndex < numBins) {
-							shiftedBins[newIndex] = bins[i];
-						}
-					}
+			ApplySingleStage(samples, numSamples, SpectralOperation::PhaseRandomize, amount, 0.0f, 0, seed);
+		}
+
+		// === BIN OPERATIONS ===
+
+		void SpectralEffects::DecayBins(DSP::ComplexBin* bins, size_t numBins, float amount, float curve) {
+			float lastBin = static_cast<float>(numBins - 1);
+
+			// Apply decay curve to each frequency bin (a real gain: scales the magnitude only)
+			DSP::ScaleBins(bins, numBins, [=](size_t i) {
+				// Normalized frequency (0.0 to 1.0)
+				float freq = static_cast<float>(i) / lastBin;
 
-					// Copy back
-					bins = shiftedBins;
-				});
+				// Calculate decay factor using power curve
+				// Higher frequencies decay more
+				float decay = 1.0f - (amount * std::pow(freq, curve));
+				return std::max(0.0f, std::min(1.0f, decay));
+			});
 		}
 
-		void SpectralEffects::ApplyPhaseRandomization(std::vector<float>& samples, float amount) {
-			if (amount < 0.001f) return;
+		void SpectralEffects::TiltBins(DSP::ComplexBin* bins, size_t numBins, float amount) {
+			float lastBin = static_cast<float>(numBins - 1);
 
-			ProcessInFrequencyDomain(samples,
-				[amount](std::vector<DSP::FrequencyBin>& bins, int fftSize) {
-					// Create random number generator inside lambda
-					static std::random_device rd;
-					static std::mt19937 gen(rd());
-					std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+			DSP::ScaleBins(bins, numBins, [=](size_t i) {
+				// Normalized frequency (0.0 to 1.0)
+				float freq = static_cast<float>(i) / lastBin;
 
-					constexpr float TWO_PI = 6.28318530718f;
+				// Linear tilt: -6dB/octave to +6dB/octave
+				float tilt = 1.0f + (amount * (freq - 0.5f) * 2.0f);
+				return std::max(0.0f, std::min(2.0f, tilt));
+			});
+		}
 
-					// Randomize phase for each bin (except DC component)
-					for (size_t i = 1; i < bins.size(); ++i) {
-						// Generate random phase between -PI and PI
-						float randomPhase = (dis(gen) * 2.0f - 1.0f) * 3.14159265359f;
+		void SpectralEffects::GateBins(DSP::ComplexBin* bins, size_t numBins, float threshold) {
+			// Compare squared magnitudes, so no square roots are needed
+			float maxNorm = 0.0f;
+			for (size_t i = 0; i < numBins; ++i) {
+				maxNorm = std::max(maxNorm, std::norm(bins[i]));
+			}
 
-						// Blend between original and random phase
-						bins[i].phase = bins[i].phase * (1.0f - amount) + randomPhase * amount;
-					}
+			// Apply gate
+			float gateNorm = maxNorm * threshold * threshold;
+			DSP::ProcessBins(bins, numBins, [=](size_t, DSP::ComplexBin& bin) {
+				if (std::norm(bin) < gateNorm) {
+					bin = DSP::ComplexBin();
+				}
+			});
+		}
 
-					// Keep DC component (i=0) phase unchanged (should be 0)
-				});
+		void SpectralEffects::ShiftBins(DSP::ComplexBin* bins, size_t numBins, int shiftAmount) {
+			int lastBin = static_cast<int>(numBins) - 1;
+
+			// Shift the bins above DC in place (DC component, index 0, stays)
+			// Walk against the shift direction so every source is read before it is overwritten
+			if (shiftAmount > 0) {
+				for (int i = lastBin; i >= 1; --i) {
+					int source = i - shiftAmount;
+					bins[i] = source >= 1 ? bins[source] : DSP::ComplexBin();
+				}
+			}
+			else {
+				for (int i = 1; i <= lastBin; ++i) {
+					int source = i - shiftAmount;
+					bins[i] = source <= lastBin ? bins[source] : DSP::ComplexBin();
+				}
+			}
 		}
 
+		void SpectralEffects::RandomizePhaseBins(DSP::ComplexBin* bins, size_t numBins, float amount, uint64_t seed) {
+			// Per-call generator: no shared state between threads, reproducible per seed
+			Utils::XorShift128Plus rng = Utils::XorShift128Plus::FromSeed(seed);
+
+			// Randomize phase for each bin (except DC component)
+			// The phase blend is the one operation that needs the polar form
+			DSP::ProcessPolarBins(bins + 1, numBins - 1, [&](size_t, float&, float& phase) {
+				// Generate random phase between -PI and PI
+				float randomPhase = (rng.NextFloat() * 2.0f - 1.0f) * 3.14159265359f;
+
+				// Blend between original and random phase
+				phase = phase * (1.0f - amount) + randomPhase * amount;
+			});
+
+			// Keep DC component (i=0) phase unchanged (should be 0)
+		}
 	}
 }
\ No newline at end of file
@@ -4,48 +4,107 @@
 #include "IFrequencyProcessor.h"
 #include <vector>
 #include <memory>
-#include <functional>
+#include <cstdint>
 
 namespace WavetableGen {
 	namespace Core {
+		// Bin operations that can be combined into one spectral pass
+		enum class SpectralOperation {
+			Decay,
+			Tilt,
+			Gate,
+			PhaseRandomize,
+			Shift
+		};
+
+		// One operation of a combined pass, with the parameters of the matching Apply* method
+		struct SpectralStage {
+			SpectralOperation operation;
+			float amount;     // Decay/tilt/randomization amount, or gate threshold
+			float curve;      // Decay curve
+			int shiftAmount;  // Shift in bins
+		};
+
 		// Spectral (frequency domain) effects processor
 		// Uses dependency injection for FFT implementation (SOLID: Dependency Inversion)
+		// Every effect has a std::vector overload and an in-place pointer + length overload
 		class SpectralEffects {
 		public:
 			// Constructor with dependency injection
+			// Not thread-safe: the processor and scratch buffers belong to this instance
 			explicit SpectralEffects(std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor);
 
 			// Apply spectral decay - progressively attenuates higher frequencies
 			// amount: 0.0 (no decay) to 1.0 (maximum decay)
 			// curve: controls the steepness of decay (1.0 = linear, >1.0 = exponential)
 			void ApplySpectralDecay(std::vector<float>& samples, float amount, float curve);
+			void ApplySpectralDecay(float* samples, size_t numSamples, float amount, float curve);
 
 			// Apply spectral tilt - linear frequency slope
 			// amount: -1.0 (darker) to 1.0 (brighter)
 			void ApplySpectralTilt(std::vector<float>& samples, float amount);
+			void ApplySpectralTilt(float* samples, size_t numSamples, float amount);
 
 			// Apply spectral gate - removes quiet frequency bins
 			// threshold: 0.0 to 1.0 (relative to max magnitude)
 			void ApplySpectralGate(std::vector<float>& samples, float threshold);
+			void ApplySpectralGate(float* samples, size_t numSamples, float threshold);
 
 			// Apply spectral shift - shifts frequency bins
 			// shiftAmount: number of bins to shift (positive or negative)
 			void ApplySpectralShift(std::vector<float>& samples, int shiftAmount);
+			void ApplySpectralShift(float* samples, size_t numSamples, int shiftAmount);
 
 			// Apply phase randomization - smears transients
 			// amount: 0.0 to 1.0 (mix of random phase)
-			void ApplyPhaseRandomization(std::vector<float>& samples, float amount);
+			// seed: random phases are drawn from this seed (same seed, same result, 0 included)
+			void ApplyPhaseRandomization(std::vector<float>& samples, float amount, uint64_t seed);
+			void ApplyPhaseRandomization(float* samples, size_t numSamples, float amount, uint64_t seed);
+
+			// Apply several effects with a single forward/inverse FFT pair: the bin operations run in
+			// order on one spectrum, and the result is rescaled once if it clips
+			// This is not the same as applying the effects one by one, which rescales after each
+			// of them. Every bin operation commutes with a gain (the gate threshold is relative to
+			// the largest bin), so for power-of-2 frames the results differ only in level, and only
+			// when an earlier stage clips. For example, a tilt of +0.5 that takes a frame to a peak of 1.2,
+			// followed by a decay that brings it back under 1.0, comes out 1.2 times louder here.
+			// Other frame sizes are also cut back from the padded size only once, not per stage.
+			// seed: used by PhaseRandomize stages
+			void ApplyStages(float* samples, size_t numSamples,
+				const SpectralStage* stages, size_t numStages, uint64_t seed);
+
+			// ApplyStages on numFrames contiguous frames of frameSize samples, with one batched
+			// forward and one batched inverse transform for all of them (same result per frame)
+			// seeds: one per frame
+			void ApplyStagesBatch(float* frames, size_t numFrames, size_t frameSize,
+				const SpectralStage* stages, size_t numStages, const uint64_t* seeds);
+
+			// Size the scratch for batches of up to numFrames frames of frameSize samples, so they
+			// do not allocate
+			void Reserve(size_t numFrames, size_t frameSize);
 
 		private:
-			// Helper to process in frequency domain
-			void ProcessInFrequencyDomain(
-				std::vector<float>& samples,
-				std::function<void(std::vector<DSP::FrequencyBin>&, int)> processor);
+			void ApplySingleStage(float* samples, size_t numSamples, SpectralOperation operation,
+				float amount, float curve, int shiftAmount, uint64_t seed);
+
+			// Bin operations (on the complex half spectrum, DC at index 0)
+			// Only phase randomization converts to polar form; the others scale or move bins
+			static void DecayBins(DSP::ComplexBin* bins, size_t numBins, float amount, float curve);
+			static void TiltBins(DSP::ComplexBin* bins, size_t numBins, float amount);
+			static void GateBins(DSP::ComplexBin* bins, size_t numBins, float threshold);
+			static void ShiftBins(DSP::ComplexBin* bins, size_t numBins, int shiftAmount);
+			static void RandomizePhaseBins(DSP::ComplexBin* bins, size_t numBins, float amount, uint64_t seed);
 
 			// Ensure samples are padded to power of 2
 			int GetPaddedSize(int size) const;
 
 			std::shared_ptr<DSP::IFrequencyProcessor> m_fftProcessor;
+
+			// Scratch reused by every call: the padded frames (transformed back in place) and their
+			// spectra, frame after frame (sized for one frame of the processor's FFT size up front,
+			// see Reserve for batches)
+			std::vector<float> m_paddedSamples;
+			std::vector<DSP::ComplexBin> m_frequencyDomain;
 		};
 	}
 }
@@ -1,100 +1,63 @@
 #include "WaveformEffects.h"
 #include "SpectralEffects.h"
-#include "KissFFTProcessor.h"
+#include "FrequencyProcessorFactory.h"
+#include "Oversampler.h"
+#include "PeriodicResampler.h"
+#include "EffectChain.h"
+#include "WaveshaperKernels.h"
+#include "AdaaWaveshaper.h"
 #include <algorithm>
 #include <cmath>
 #include <memory>
 
 namespace WavetableGen {
 	namespace Core {
-		constexpr double PI = 3.14159265358979323846;
-
 		// Apply all effects in proper order
-		void WaveformEffects::ApplyEffects(std::vector<float>& samples, const EffectsSettings& settings) {
-			if (samples.empty()) return;
-
-			// Order matters for quality:
-			// 1. Symmetry operations (no frequency content changes)
-			// 2. Aliasing-prone effects (with oversampling)
-			// 3. Filtering (removes unwanted frequencies)
-
-			// Step 1: Symmetry operations (safe, no oversampling needed)
-			if (settings.reverse) {
-				ApplyReverse(samples);
-			}
-			if (settings.mirrorHorizontal) {
-				ApplyMirrorHorizontal(samples);
-			}
-			if (settings.mirrorVertical) {
-				ApplyMirrorVertical(samples);
-			}
-			if (settings.invert) {
-				ApplyInvert(samples);
-			}
-
-			// Step 2: Non-linear effects (require oversampling)
-			if (settings.distortionType != DistortionType::None && settings.distortionAmount > 0.001f) {
-				ApplyDistortion(samples, settings.distortionType, settings.distortionAmount);
-			}
-			if (settings.enableWavefold && settings.wavefoldAmount > 0.001f) {
-				ApplyWavefold(samples, settings.wavefoldAmount);
-			}
-			if (settings.enableBitCrush && settings.bitDepth < 16) {
-				ApplyBitCrush(samples, settings.bitDepth);
-			}
-			if (settings.enableSampleRateReduction && settings.sampleRateReductionFactor > 1) {
-				ApplySampleRateReduction(samples, settings.sampleRateReductionFactor);
-			}
-
-
-			// Step 3: Filtering (removes aliasing and shapes spectrum)
-			if (settings.enableHighPass && settings.highPassCutoff > 0.001f) {
-				ApplyHighPassFilter(samples, settings.highPassCutoff);
-			}
-			if (settings.enableLowPass && settings.lowPassCutoff < 0.999f) {
-				ApplyLowPassFilter(samples, settings.lowPassCutoff);
-			}
+		void WaveformEffects::ApplyEffects(std::vector<float>& samples, const EffectsSettings& settings, uint64_t seed) {
+			ApplyEffects(samples.data(), samples.size(), settings, seed);
+		}
 
-			// Step 4: Spectral effects (frequency domain processing)
-			if (settings.enableSpectralDecay && settings.spectralDecayAmount > 0.001f) {
-				ApplySpectralDecay(samples, settings.spectralDecayAmount, settings.spectralDecayCurve);
-			}
-			if (settings.enableSpectralTilt && std::abs(settings.spectralTiltAmount) > 0.001f) {
-				ApplySpectralTilt(samples, settings.spectralTiltAmount);
-			}
-			if (settings.enableSpectralGate && settings.spectralGateThreshold > 0.001f) {
-				ApplySpectralGate(samples, settings.spectralGateThreshold);
-			}
-			if (settings.enablePhaseRandomize && settings.phaseRandomizeAmount > 0.001f) {
-				ApplyPhaseRandomization(samples, settings.phaseRandomizeAmount);
-			}
-			if (settings.enableSpectralShift && settings.spectralShiftAmount != 0) {
-				ApplySpectralShift(samples, settings.spectralShiftAmount);
-			}
+		void WaveformEffects::ApplyEffects(float* samples, size_t numSamples, const EffectsSettings& settings, uint64_t seed) {
+			if (numSamples == 0) return;
 
+			// One-off chain; callers processing many frames keep an EffectChain instead
+			EffectChain chain(settings, numSamples);
+			chain.Process(samples, seed);
 		}
 
 		// === SAFE EFFECTS (No oversampling needed) ===
 
 		void WaveformEffects::ApplyLowPassFilter(std::vector<float>& samples, float cutoff) {
+			ApplyLowPassFilter(samples.data(), samples.size(), cutoff);
+		}
+
+		void WaveformEffects::ApplyLowPassFilter(float* samples, size_t numSamples, float cutoff) {
+			if (numSamples == 0) return;
+
 			// Simple one-pole IIR low-pass filter
 			// cutoff: 0.0-1.0 (fraction of Nyquist frequency)
 			float alpha = cutoff;
 			float prev = samples[0];
 
-			for (size_t i = 1; i < samples.size(); ++i) {
+			for (size_t i = 1; i < numSamples; ++i) {
 				samples[i] = prev + alpha * (samples[i] - prev);
 				prev = samples[i];
 			}
 		}
 
 		void WaveformEffects::ApplyHighPassFilter(std::vector<float>& samples, float cutoff) {
+			ApplyHighPassFilter(samples.data(), samples.size(), cutoff);
+		}
+
+		void WaveformEffects::ApplyHighPassFilter(float* samples, size_t numSamples, float cutoff) {
+			if (numSamples == 0) return;
+
 			// Simple one-pole IIR high-pass filter
 			float alpha = 1.0f - cutoff;
 			float prev_input = samples[0];
 			float prev_output = 0.0f;
 
-			for (size_t i = 1; i < samples.size(); ++i) {
+			for (size_t i = 1; i < numSamples; ++i) {
 				float input = samples[i];
 				float output = alpha * (prev_output + input - prev_input);
 				samples[i] = output;
@@ -104,214 +67,432 @@ namespace WavetableGen {
 		}
 
 		void WaveformEffects::ApplyMirrorHorizontal(std::vector<float>& samples) {
-			size_t half = samples.size() / 2;
+			ApplyMirrorHorizontal(samples.data(), samples.size());
+		}
+
+		void WaveformEffects::ApplyMirrorHorizontal(float* samples, size_t numSamples) {
+			size_t half = numSamples / 2;
 			for (size_t i = 0; i < half; ++i) {
 				samples[half + i] = samples[half - i - 1];
 			}
 		}
 
 		void WaveformEffects::ApplyMirrorVertical(std::vector<float>& samples) {
-			for (float& s : samples) {
-				s = -s;
+			ApplyMirrorVertical(samples.data(), samples.size());
+		}
+
+		void WaveformEffects::ApplyMirrorVertical(float* samples, size_t numSamples) {
+			for (size_t i = 0; i < numSamples; ++i) {
+				samples[i] = -samples[i];
 			}
 		}
 
 		void WaveformEffects::ApplyInvert(std::vector<float>& samples) {
-			for (float& s : samples) {
-				s = -s;
+			ApplyInvert(samples.data(), samples.size());
+		}
+
+		void WaveformEffects::ApplyInvert(float* samples, size_t numSamples) {
+			for (size_t i = 0; i < numSamples; ++i) {
+				samples[i] = -samples[i];
 			}
 		}
 
 		void WaveformEffects::ApplyReverse(std::vector<float>& samples) {
-			std::reverse(samples.begin(), samples.end());
+			ApplyReverse(samples.data(), samples.size());
+		}
+
+		void WaveformEffects::ApplyReverse(float* samples, size_t numSamples) {
+			std::reverse(samples, samples + numSamples);
 		}
 
 		// === ALIASING-PRONE EFFECTS (Use oversampling) ===
 
 		void WaveformEffects::ApplyDistortion(std::vector<float>& samples, DistortionType type, float amount) {
-			if (type == DistortionType::None || amount < 0.001f) return;
-
-			// Oversample for anti-aliasing
-			std::vector<float> oversampled = Oversample4x(samples);
+			ApplyDistortion(samples.data(), samples.size(), type, amount);
+		}
 
-			// Apply distortion at higher sample rate
-			switch (type) {
-			case DistortionType::Soft:
-				ApplySoftDistortion(oversampled, amount);
-				break;
-			case DistortionType::Hard:
-				ApplyHardDistortion(oversampled, amount);
-				break;
-			case DistortionType::Asymmetric:
-				ApplyAsymmetricDistortion(oversampled, amount);
-				break;
-			default:
-				break;
-			}
+		void WaveformEffects::ApplyDistortion(float* samples, size_t numSamples, DistortionType type, float amount, float* scratch) {
+			if (type == DistortionType::None || amount < 0.001f) return;
 
-			// Downsample with anti-aliasing filter
-			samples = Downsample4x(oversampled);
+			NonlinearStage stage;
+			stage.distortionType = type;
+			stage.distortionAmount = amount;
+			ApplyNonlinearStage(samples, numSamples, stage, scratch);
 		}
 
 		void WaveformEffects::ApplyBitCrush(std::vector<float>& samples, int bits) {
-			if (bits >= 16) return;
-
-			// Oversample for anti-aliasing
-			std::vector<float> oversampled = Oversample4x(samples);
-
-			// Apply bit crushing at higher sample rate
-			int levels = (1 << bits);
-			float step = 2.0f / (float)levels;
+			ApplyBitCrush(samples.data(), samples.size(), bits);
+		}
 
-			for (float& s : oversampled) {
-				s = std::floor(s / step) * step;
-			}
+		void WaveformEffects::ApplyBitCrush(float* samples, size_t numSamples, int bits, float* scratch) {
+			if (bits >= 16) return;
 
-			// Downsample with anti-aliasing filter
-			samples = Downsample4x(oversampled);
+			NonlinearStage stage;
+			stage.bitDepth = bits;
+			ApplyNonlinearStage(samples, numSamples, stage, scratch);
 		}
 
 		void WaveformEffects::ApplyWavefold(std::vector<float>& samples, float amount) {
-			if (amount < 0.001f) return;
+			ApplyWavefold(samples.data(), samples.size(), amount);
+		}
 
-			// Oversample for anti-aliasing
-			std::vector<float> oversampled = Oversample4x(samples);
-
-			// Apply wavefolding at higher sample rate
-			float gain = 1.0f + amount * 3.0f; // 1x to 4x gain
-			for (float& s : oversampled) {
-				float folded = s * gain;
-				// Triangle folding
-				while (folded > 1.0f || folded < -1.0f) {
-					if (folded > 1.0f) folded = 2.0f - folded;
-					if (folded < -1.0f) folded = -2.0f - folded;
-				}
-				s = folded;
-			}
+		void WaveformEffects::ApplyWavefold(float* samples, size_t numSamples, float amount, float* scratch) {
+			if (amount < 0.001f) return;
 
-			// Downsample with anti-aliasing filter
-			samples = Downsample4x(oversampled);
+			NonlinearStage stage;
+			stage.wavefoldAmount = amount;
+			ApplyNonlinearStage(samples, numSamples, stage, scratch);
 		}
 
 		void WaveformEffects::ApplySampleRateReduction(std::vector<float>& samples, int factor) {
+			ApplySampleRateReduction(samples.data(), samples.size(), factor);
+		}
+
+		void WaveformEffects::ApplySampleRateReduction(float* samples, size_t numSamples, int factor, float* scratch) {
 			if (factor <= 1) return;
 
-			// Oversample for anti-aliasing
-			std::vector<float> oversampled = Oversample4x(samples);
-
-			// Apply sample rate reduction at higher sample rate
-			// This simulates a lower sample rate by holding values.
-			// The 'factor' applies to the original sample rate.
-			// In the 4x oversampled domain, we need to hold for 'factor * 4' samples.
-			float current_sample_value = 0.0f;
-			int hold_counter = 0; // Counts down from (factor * 4)
-			for (size_t i = 0; i < oversampled.size(); ++i) {
-				if (hold_counter == 0) {
-					current_sample_value = oversampled[i];
-					hold_counter = factor * 4; // Reset hold counter
+			NonlinearStage stage;
+			stage.sampleRateReductionFactor = factor;
+			ApplyNonlinearStage(samples, numSamples, stage, scratch);
+		}
+
+		// === FUSED NONLINEAR STAGE ===
+
+		namespace {
+			// Alias-to-harmonic energy (dB) of one effect setting at 1x, 2x, 4x and 8x oversampling.
+			// Measured on a sine at a tenth of the base-rate Nyquist (harmonic 101 of 2048), through
+			// each resampler. Each row is the worst case over sine amplitudes 0.25 to 1.0 (frames
+			// reach the effects normalized to full scale) and over the amounts between the previous
+			// row and its own. Generated by the OversamplingTables benchmark
+			// (Bench/OversamplingTablesBench.cpp).
+			struct AliasMeasurement {
+				float amount;
+				float aliasDb[4];
+			};
+
+			// One table per effect. Sample rate reduction needs none: its aliasing is the effect
+			// itself, and oversampling changes it by less than 1 dB.
+			struct AliasTables {
+				AliasMeasurement soft[7];
+				AliasMeasurement hard[7];
+				AliasMeasurement asymmetric[7];
+				AliasMeasurement wavefold[7];
+				AliasMeasurement bitCrush[8]; // Amount: bits removed (16 - bit depth)
+			};
+
+			// Polyphase Oversampler (Oversampling, ADAA's bit crush, non-power-of-2 periodic frames).
+			// It treats the frame as zero outside the buffer, and its transition band starts at 0.4 of
+			// the base rate, so its error floor sits at -40 to -64 dB: beyond 2x, more oversampling
+			// gains little, and mild settings alias less without it.
+			const AliasTables POLYPHASE_ALIASING = {
+				// Soft
+				{
+					{ 0.02f, { -97.7f, -60.8f, -60.1f, -60.0f } },
+					{ 0.05f, { -84.2f, -59.7f, -59.0f, -58.9f } },
+					{ 0.10f, { -68.5f, -57.8f, -57.2f, -57.1f } },
+					{ 0.25f, { -44.9f, -52.7f, -52.2f, -52.1f } },
+					{ 0.50f, { -30.8f, -46.5f, -46.1f, -46.1f } },
+					{ 0.75f, { -25.1f, -43.2f, -42.9f, -42.8f } },
+					{ 1.00f, { -22.2f, -41.0f, -41.1f, -41.0f } }
+				},
+				// Hard
+				{
+					{ 0.02f, { -50.9f, -61.7f, -62.4f, -62.4f } },
+					{ 0.05f, { -48.5f, -60.2f, -61.7f, -61.7f } },
+					{ 0.10f, { -47.2f, -59.6f, -61.8f, -61.8f } },
+					{ 0.25f, { -42.4f, -55.6f, -59.3f, -59.6f } },
+					{ 0.50f, { -37.7f, -51.8f, -55.5f, -55.9f } },
+					{ 0.75f, { -31.8f, -45.9f, -51.4f, -52.0f } },
+					{ 1.00f, { -19.4f, -36.0f, -39.0f, -39.4f } }
+				},
+				// Asymmetric
+				{
+					{ 0.02f, { -44.8f, -58.2f, -63.5f, -64.1f } },
+					{ 0.05f, { -44.5f, -57.9f, -63.1f, -63.7f } },
+					{ 0.10f, { -43.9f, -57.3f, -62.5f, -63.1f } },
+					{ 0.25f, { -41.9f, -55.7f, -60.7f, -61.2f } },
+					{ 0.50f, { -38.7f, -53.2f, -57.7f, -58.1f } },
+					{ 0.75f, { -35.7f, -50.8f, -54.8f, -55.1f } },
+					{ 1.00f, { -33.3f, -48.7f, -52.2f, -52.4f } }
+				},
+				// Wavefold
+				{
+					{ 0.02f, { -42.4f, -56.0f, -59.4f, -59.5f } },
+					{ 0.05f, { -36.7f, -51.7f, -56.3f, -56.9f } },
+					{ 0.10f, { -35.6f, -49.0f, -54.6f, -55.1f } },
+					{ 0.25f, { -28.6f, -42.7f, -48.3f, -48.8f } },
+					{ 0.50f, { -21.0f, -36.1f, -41.2f, -41.7f } },
+					{ 0.75f, { -21.0f, -36.1f, -41.2f, -41.7f } },
+					{ 1.00f, { -19.1f, -32.0f, -39.3f, -40.4f } }
+				},
+				// Bit crush
+				{
+					{ 1.0f, { -79.8f, -63.7f, -63.1f, -63.0f } },
+					{ 4.0f, { -62.1f, -61.3f, -61.8f, -62.3f } },
+					{ 6.0f, { -50.0f, -52.8f, -55.2f, -57.4f } },
+					{ 8.0f, { -38.1f, -41.0f, -44.9f, -47.8f } },
+					{ 10.0f, { -26.8f, -28.9f, -36.6f, -42.9f } },
+					{ 12.0f, { -15.9f, -22.2f, -27.2f, -31.4f } },
+					{ 14.0f, { -13.6f, -17.4f, -21.6f, -25.7f } },
+					{ 15.0f, { -13.6f, -17.4f, -21.6f, -25.7f } }
+				}
+			};
+
+			// PeriodicResampler (PeriodicOversampling): exact for a periodic frame, so only the
+			// effect's own aliasing remains
+			const AliasTables PERIODIC_ALIASING = {
+				// Soft
+				{
+					{ 0.02f, { -97.7f, -132.5f, -132.9f, -132.4f } },
+					{ 0.05f, { -84.2f, -132.2f, -132.4f, -131.8f } },
+					{ 0.10f, { -68.5f, -131.8f, -132.8f, -133.3f } },
+					{ 0.25f, { -44.9f, -125.6f, -132.8f, -133.7f } },
+					{ 0.50f, { -30.8f, -79.8f, -133.3f, -133.2f } },
+					{ 0.75f, { -25.1f, -60.2f, -128.6f, -133.9f } },
+					{ 1.00f, { -22.2f, -49.6f, -103.9f, -133.6f } }
+				},
+				// Hard
+				{
+					{ 0.02f, { -50.9f, -67.1f, -80.8f, -93.7f } },
+					{ 0.05f, { -48.5f, -63.7f, -76.4f, -89.2f } },
+					{ 0.10f, { -47.2f, -61.1f, -73.6f, -85.8f } },
+					{ 0.25f, { -42.4f, -56.6f, -69.2f, -81.9f } },
+					{ 0.50f, { -37.7f, -52.2f, -64.5f, -76.7f } },
+					{ 0.75f, { -31.8f, -46.4f, -58.9f, -72.1f } },
+					{ 1.00f, { -19.4f, -37.5f, -47.7f, -63.1f } }
+				},
+				// Asymmetric
+				{
+					{ 0.02f, { -44.8f, -59.2f, -71.7f, -84.0f } },
+					{ 0.05f, { -44.5f, -58.9f, -71.4f, -83.7f } },
+					{ 0.10f, { -43.9f, -58.4f, -70.9f, -83.2f } },
+					{ 0.25f, { -41.9f, -56.9f, -69.5f, -81.8f } },
+					{ 0.50f, { -38.7f, -54.6f, -67.2f, -79.5f } },
+					{ 0.75f, { -35.7f, -52.5f, -65.3f, -77.6f } },
+					{ 1.00f, { -33.3f, -50.6f, -63.6f, -76.0f } }
+				},
+				// Wavefold
+				{
+					{ 0.02f, { -42.4f, -57.6f, -69.6f, -82.5f } },
+					{ 0.05f, { -36.7f, -52.6f, -65.3f, -77.8f } },
+					{ 0.10f, { -35.6f, -48.9f, -61.8f, -74.4f } },
+					{ 0.25f, { -28.6f, -43.2f, -55.2f, -67.9f } },
+					{ 0.50f, { -21.0f, -37.2f, -49.6f, -62.6f } },
+					{ 0.75f, { -21.0f, -36.7f, -49.2f, -62.0f } },
+					{ 1.00f, { -19.1f, -32.5f, -45.1f, -56.1f } }
+				},
+				// Bit crush
+				{
+					{ 1.0f, { -79.8f, -82.7f, -85.9f, -89.0f } },
+					{ 4.0f, { -62.1f, -64.6f, -68.1f, -71.5f } },
+					{ 6.0f, { -50.0f, -53.1f, -56.1f, -58.9f } },
+					{ 8.0f, { -38.1f, -41.1f, -45.1f, -48.0f } },
+					{ 10.0f, { -26.8f, -29.1f, -37.1f, -44.4f } },
+					{ 12.0f, { -15.9f, -23.4f, -29.2f, -35.6f } },
+					{ 14.0f, { -13.6f, -20.2f, -26.2f, -32.2f } },
+					{ 15.0f, { -13.6f, -20.2f, -26.2f, -32.2f } }
+				}
+			};
+
+
+			// Factor for one effect, judged by the first row at or above amount (the most severe row
+			// if amount exceeds the table): the smallest factor whose aliasing meets targetDb or, if
+			// none does, the smallest factor within 1 dB of the least aliasing (a higher factor that
+			// buys less than that is not worth its cost)
+			template <size_t N>
+			int FactorFor(const AliasMeasurement (&table)[N], float amount, float targetDb) {
+				const AliasMeasurement* row = &table[N - 1];
+				for (size_t i = 0; i < N; ++i) {
+					if (table[i].amount >= amount) {
+						row = &table[i];
+						break;
+					}
+				}
+				float leastDb = row->aliasDb[0];
+				for (int i = 0; i < 4; ++i) {
+					if (row->aliasDb[i] <= targetDb) return 1 << i;
+					leastDb = std::min(leastDb, row->aliasDb[i]);
 				}
-				oversampled[i] = current_sample_value;
-				hold_counter--;
+				for (int i = 0; i < 4; ++i) {
+					if (row->aliasDb[i] <= leastDb + 1.0f) return 1 << i;
+				}
+				return 8;
 			}
 
-			// Downsample with anti-aliasing filter
-			samples = Downsample4x(oversampled);
-		}
+			int FactorIndex(int factor) {
+				return factor == 1 ? 0 : factor == 2 ? 1 : factor == 4 ? 2 : 3;
+			}
+
+			// Shared oversamplers, one per factor (stateless: the filter coefficients are fixed)
+			const DSP::Oversampler& GetOversampler(int factor) {
+				static const DSP::Oversampler oversamplers[] = {
+					DSP::Oversampler(1), DSP::Oversampler(2), DSP::Oversampler(4), DSP::Oversampler(8)
+				};
+				return oversamplers[FactorIndex(factor)];
+			}
+
+			// Periodic resampler for this thread (its FFT plans hold scratch), one per factor, re-planned
+			// when the frame size changes; nullptr if the size cannot be resampled as a period
+			DSP::PeriodicResampler* GetPeriodicResampler(size_t numSamples, int factor) {
+				if (numSamples < 2 || (numSamples & (numSamples - 1)) != 0) return nullptr;
 
-		// === DISTORTION IMPLEMENTATIONS ===
+				thread_local std::unique_ptr<DSP::PeriodicResampler> resamplers[4];
+				std::unique_ptr<DSP::PeriodicResampler>& resampler = resamplers[FactorIndex(factor)];
+				if (!resampler || resampler->GetNumSamples() != numSamples) {
+					resampler.reset(new DSP::PeriodicResampler(numSamples, factor));
+				}
+				return resampler.get();
+			}
 
-		void WaveformEffects::ApplySoftDistortion(std::vector<float>& samples, float amount) {
-			float drive = 1.0f + amount * 9.0f; // 1x to 10x drive
-			for (float& s : samples) {
-				s = std::tanh(s * drive);
+			// Scratch for callers that do not supply any: one buffer per thread, grown on demand and
+			// reused by every effect, so steady-state processing does not allocate
+			float* GetThreadScratch(size_t size) {
+				thread_local std::vector<float> scratch;
+				if (scratch.size() < size) scratch.resize(size);
+				return scratch.data();
 			}
 		}
 
-		void WaveformEffects::ApplyHardDistortion(std::vector<float>& samples, float amount) {
-			float threshold = 1.0f - amount * 0.9f; // Threshold from 1.0 to 0.1
-			for (float& s : samples) {
-				if (s > threshold) s = threshold;
-				else if (s < -threshold) s = -threshold;
-			}
+		bool WaveformEffects::NonlinearStage::IsEmpty() const {
+			bool distortion = distortionType != DistortionType::None && distortionAmount >= 0.001f;
+			bool wavefold = wavefoldAmount >= 0.001f;
+			return !distortion && !wavefold && bitDepth >= 16 && sampleRateReductionFactor <= 1;
 		}
 
-		void WaveformEffects::ApplyAsymmetricDistortion(std::vector<float>& samples, float amount) {
-			float drive = 1.0f + amount * 4.0f;
-			for (float& s : samples) {
-				if (s > 0.0f) {
-					s = std::tanh(s * drive);
-				}
-				else {
-					s = std::tanh(s * drive * 0.5f); // Asymmetric - less drive on negative
+		int WaveformEffects::NonlinearStage::GetOversamplingFactor() const {
+			float targetDb;
+			switch (quality) {
+			case OversamplingQuality::Draft:
+				targetDb = -40.0f;
+				break;
+			case OversamplingQuality::High:
+				targetDb = -80.0f;
+				break;
+			case OversamplingQuality::Maximum:
+				targetDb = -INFINITY;  // Never met: the least aliasing
+				break;
+			default:
+				targetDb = -60.0f;
+				break;
+			}
+
+			// Only PeriodicOversampling resamples periodically; ADAA oversamples its bit crush with
+			// the polyphase resampler
+			const AliasTables& tables = antiAliasing == AntiAliasing::PeriodicOversampling ? PERIODIC_ALIASING : POLYPHASE_ALIASING;
+
+			// The most demanding effect decides; ADAA handles distortion and wavefold at the base rate.
+			// Hard clipping and folding have corners at any amount, so their harmonics fall off slowly
+			// and fundamentals above the tables' harmonic alias far more: they never run at 1x.
+			int factor = 1;
+			bool adaa = antiAliasing == AntiAliasing::ADAA1 || antiAliasing == AntiAliasing::ADAA2;
+			if (!adaa && distortionAmount >= 0.001f) {
+				switch (distortionType) {
+				case DistortionType::Soft:
+					factor = std::max(factor, FactorFor(tables.soft, distortionAmount, targetDb));
+					break;
+				case DistortionType::Hard:
+					factor = std::max(factor, std::max(2, FactorFor(tables.hard, distortionAmount, targetDb)));
+					break;
+				case DistortionType::Asymmetric:
+					factor = std::max(factor, FactorFor(tables.asymmetric, distortionAmount, targetDb));
+					break;
+				default:
+					break;
 				}
 			}
+			if (!adaa && wavefoldAmount >= 0.001f) {
+				factor = std::max(factor, std::max(2, FactorFor(tables.wavefold, wavefoldAmount, targetDb)));
+			}
+			if (bitDepth < 16) {
+				factor = std::max(factor, FactorFor(tables.bitCrush, (float)(16 - bitDepth), targetDb));
+			}
+			return factor;
+		}
+
+		size_t WaveformEffects::GetNonlinearScratchSize(size_t numSamples) {
+			// The signal at the highest factor followed by the resampler's own scratch
+			return numSamples * 8 + GetOversampler(8).GetScratchSize(numSamples);
 		}
 
-		// === OVERSAMPLING INFRASTRUCTURE ===
+		void WaveformEffects::ApplyNonlinearStage(std::vector<float>& samples, const NonlinearStage& stage) {
+			ApplyNonlinearStage(samples.data(), samples.size(), stage);
+		}
 
-		std::vector<float> WaveformEffects::Oversample4x(const std::vector<float>& input) {
-			size_t inputSize = input.size();
-			size_t outputSize = inputSize * 4;
-			std::vector<float> output(outputSize, 0.0f);
+		void WaveformEffects::ApplyNonlinearStage(float* samples, size_t numSamples, const NonlinearStage& stage, float* scratch) {
+			if (numSamples == 0 || stage.IsEmpty()) return;
 
-			// Insert zeros between samples
-			for (size_t i = 0; i < inputSize; ++i) {
-				output[i * 4] = input[i] * 4.0f; // Compensate for energy loss
+			if (!scratch) {
+				scratch = GetThreadScratch(GetNonlinearScratchSize(numSamples));
 			}
 
-			// Apply interpolation filter (simple windowed-sinc approximation)
-			// Using a simple 16-tap FIR filter for speed
-			const int filterTaps = 16;
-			std::vector<float> filtered(outputSize);
-
-			for (size_t i = 0; i < outputSize; ++i) {
-				float sum = 0.0f;
-				for (int j = -filterTaps / 2; j < filterTaps / 2; ++j) {
-					int idx = (int)i + j;
-					if (idx >= 0 && idx < (int)outputSize) {
-						// Lanczos kernel
-						float x = (float)j / 4.0f;
-						float sinc = (x == 0.0f) ? 1.0f : (float)(std::sin(PI * x) / (PI * x));
-						float window = (x == 0.0f) ? 1.0f : (float)(std::sin(PI * x / 4.0f) / (PI * x / 4.0f));
-						sum += output[idx] * sinc * window;
-					}
+			int factor = stage.GetOversamplingFactor();
+
+			// Periodic: the frame is one cycle, so resample its spectrum (oversampled signal in scratch)
+			if (stage.antiAliasing == AntiAliasing::PeriodicOversampling) {
+				DSP::PeriodicResampler* resampler = GetPeriodicResampler(numSamples, factor);
+				if (resampler) {
+					resampler->Upsample(samples, scratch);
+					ProcessOversampled(scratch, numSamples * factor, stage, factor);
+					resampler->Downsample(scratch, samples);
+					return;
 				}
-				filtered[i] = sum;
-			}
 
-			return filtered;
-		}
+				// Not a power of 2: fall through to the polyphase path, with its own factor
+				NonlinearStage polyphase = stage;
+				polyphase.antiAliasing = AntiAliasing::Oversampling;
+				factor = polyphase.GetOversamplingFactor();
+			}
 
-		std::vector<float> WaveformEffects::Downsample4x(const std::vector<float>& input) {
-			// First apply anti-aliasing filter
-			std::vector<float> filtered = input;
-			ApplyAntiAliasingFilter(filtered);
+			// ADAA: distortion and wavefold at the base rate; whatever remains is oversampled
+			const NonlinearStage* oversampledStage = &stage;
+			NonlinearStage remaining;
+			if (stage.antiAliasing == AntiAliasing::ADAA1 || stage.antiAliasing == AntiAliasing::ADAA2) {
+				AdaaWaveshaper::Process(samples, numSamples, WaveshaperParams::FromStage(stage), stage.antiAliasing, scratch);
 
-			// Then decimate (keep every 4th sample)
-			size_t outputSize = input.size() / 4;
-			std::vector<float> output(outputSize);
+				remaining.bitDepth = stage.bitDepth;
+				remaining.sampleRateReductionFactor = stage.sampleRateReductionFactor;
+				if (remaining.IsEmpty()) return;
+				oversampledStage = &remaining;
+			}
 
-			for (size_t i = 0; i < outputSize; ++i) {
-				output[i] = filtered[i * 4];
+			// Mild settings need no oversampling at all
+			if (factor == 1) {
+				ProcessOversampled(samples, numSamples, *oversampledStage, 1);
+				return;
 			}
 
-			return output;
-		}
+			const DSP::Oversampler& oversampler = GetOversampler(factor);
+			float* oversampled = scratch;
+			float* resamplerScratch = scratch + numSamples * factor;
+
+			// Oversample for anti-aliasing
+			oversampler.Upsample(samples, numSamples, oversampled, resamplerScratch);
 
-		void WaveformEffects::ApplyAntiAliasingFilter(std::vector<float>& samples) {
-			// Low-pass filter at 1/4 Nyquist (for 4x downsampling)
-			// Simple multi-pass moving average approximates sinc filter
-			const int passes = 4;
-			const int windowSize = 8;
+			// Apply the nonlinearities at higher sample rate
+			ProcessOversampled(oversampled, numSamples * factor, *oversampledStage, factor);
+
+			// Downsample with anti-aliasing filter
+			oversampler.Downsample(oversampled, numSamples, samples, resamplerScratch);
+		}
 
-			for (int pass = 0; pass < passes; ++pass) {
-				std::vector<float> temp = samples;
-				for (size_t i = windowSize; i < samples.size() - windowSize; ++i) {
-					float sum = 0.0f;
-					for (int j = -windowSize / 2; j < windowSize / 2; ++j) {
-						sum += temp[i + j];
+		void WaveformEffects::ProcessOversampled(float* samples, size_t count, const NonlinearStage& stage, int factor) {
+			// Distortion, wavefold and bit crush are memoryless: one vectorized pass
+			WaveshaperParams params = WaveshaperParams::FromStage(stage);
+			if (!params.IsEmpty()) {
+				static const WaveshaperKernel waveshaper = WaveshaperKernels::Get();
+				waveshaper(samples, count, params);
+			}
+
+			// Sample rate reduction holds values; the reduction factor applies to the original sample
+			// rate, so in the oversampled domain we hold for 'reduction * factor' samples
+			if (stage.sampleRateReductionFactor > 1) {
+				size_t holdLength = (size_t)stage.sampleRateReductionFactor * (size_t)factor;
+				for (size_t i = 0; i < count; i += holdLength) {
+					float heldValue = samples[i];
+					size_t end = std::min(i + holdLength, count);
+					for (size_t j = i + 1; j < end; ++j) {
+						samples[j] = heldValue;
 					}
-					samples[i] = sum / (float)windowSize;
 				}
 			}
 		}
@@ -345,45 +526,51 @@ namespace WavetableGen {
 
 		// === SPECTRAL EFFECTS ===
 
+		// Lazy-initialized spectral processor per thread: its spectrum buffers are scratch state, so
+		// threads generating concurrently must not share one (the FFT plans are per thread anyway)
+		static SpectralEffects& GetSpectralEffects() {
+			thread_local SpectralEffects spectralFX(DSP::FrequencyProcessorFactory::Create(2048));
+			return spectralFX;
+		}
+
 		void WaveformEffects::ApplySpectralDecay(std::vector<float>& samples, float amount, float curve) {
-			// Lazy-initialized singleton for FFT processor (matches existing pattern)
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(2048);
-			static Core::SpectralEffects spectralFX(fftProcessor);
+			GetSpectralEffects().ApplySpectralDecay(samples.data(), samples.size(), amount, curve);
+		}
 
-			spectralFX.ApplySpectralDecay(samples, amount, curve);
+		void WaveformEffects::ApplySpectralDecay(float* samples, size_t numSamples, float amount, float curve) {
+			GetSpectralEffects().ApplySpectralDecay(samples, numSamples, amount, curve);
 		}
 
 		void WaveformEffects::ApplySpectralTilt(std::vector<float>& samples, float amount) {
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(2048);
-			static Core::SpectralEffects spectralFX(fftProcessor);
+			GetSpectralEffects().ApplySpectralTilt(samples.data(), samples.size(), amount);
+		}
 
-			spectralFX.ApplySpectralTilt(samples, amount);
+		void WaveformEffects::ApplySpectralTilt(float* samples, size_t numSamples, float amount) {
+			GetSpectralEffects().ApplySpectralTilt(samples, numSamples, amount);
 		}
 
 		void WaveformEffects::ApplySpectralGate(std::vector<float>& samples, float threshold) {
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(2048);
-			static Core::SpectralEffects spectralFX(fftProcessor);
+			GetSpectralEffects().ApplySpectralGate(samples.data(), samples.size(), threshold);
+		}
 
-			spectralFX.ApplySpectralGate(samples, threshold);
+		void WaveformEffects::ApplySpectralGate(float* samples, size_t numSamples, float threshold) {
+			GetSpectralEffects().ApplySpectralGate(samples, numSamples, threshold);
 		}
 
-		void WaveformEffects::ApplyPhaseRandomization(std::vector<float>& samples, float amount) {
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(2048);
-			static Core::SpectralEffects spectralFX(fftProcessor);
+		void WaveformEffects::ApplyPhaseRandomization(std::vector<float>& samples, float amount, uint64_t seed) {
+			GetSpectralEffects().ApplyPhaseRandomization(samples.data(), samples.size(), amount, seed);
+		}
 
-			spectralFX.ApplyPhaseRandomization(samples, amount);
+		void WaveformEffects::ApplyPhaseRandomization(float* samples, size_t numSamples, float amount, uint64_t seed) {
+			GetSpectralEffects().ApplyPhaseRandomization(samples, numSamples, amount, seed);
 		}
 
 		void WaveformEffects::ApplySpectralShift(std::vector<float>& samples, int shiftAmount) {
-			static std::shared_ptr<DSP::IFrequencyProcessor> fftProcessor =
-				std::make_shared<DSP::KissFFTProcessor>(2048);
-			static Core::SpectralEffects spectralFX(fftProcessor);
+			GetSpectralEffects().ApplySpectralShift(samples.data(), samples.size(), shiftAmount);
+		}
 
-			spectralFX.ApplySpectralShift(samples, shiftAmount);
+		void WaveformEffects::ApplySpectralShift(float* samples, size_t numSamples, int shiftAmount) {
+			GetSpectralEffects().ApplySpectralShift(samples, numSamples, shiftAmount);
 		}
 
 	} // namespace Core
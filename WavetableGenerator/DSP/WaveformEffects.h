@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <cmath>
+#include <cstdint>
 
 namespace WavetableGen {
 	namespace Core {
@@ -14,6 +15,38 @@ namespace WavetableGen {
 			Asymmetric // Asymmetric distortion
 		};
 
+		// How the aliasing-prone effects suppress aliasing
+		enum class AntiAliasing {
+			Oversampling,         // Polyphase oversampling
+			// Oversampling by zero-padding the spectrum of the period (exact, no edge transients).
+			// Opt-in: output differs from the default. On the fast FFT backend a 4x round trip takes
+			// about half the time of polyphase (2048 samples: 51 us vs 98 us, PeriodicResampling
+			// benchmark); frame sizes that are not a power of 2 fall back to polyphase.
+			PeriodicOversampling,
+			ADAA1,                // First-order antiderivative anti-aliasing at the base rate (half-sample delay)
+			ADAA2                 // Second-order antiderivative anti-aliasing at the base rate
+		};
+
+		// Cost/quality trade-off of the oversampling factor (1x-8x), which is picked per effect and
+		// amount from alias energy measured through the resampler the anti-aliasing mode uses.
+		// PeriodicOversampling reaches every target. The polyphase resampler (Oversampling, and
+		// ADAA's bit crush) bottoms out at -40 to -64 dB depending on the effect, so Standard and
+		// High often cannot be met there: a level whose target no factor meets gets the least
+		// aliasing factor instead, as Maximum does.
+		enum class OversamplingQuality {
+			Draft,    // Smallest factor keeping aliasing below -40 dB
+			Standard, // Smallest factor keeping aliasing below -60 dB
+			High,     // Smallest factor keeping aliasing below -80 dB
+			Maximum   // Least aliasing (the smallest factor within 1 dB of it)
+		};
+
+		// Low-/high-pass filter shapes
+		enum class FilterType {
+			OnePole,      // 6 dB/octave one-pole IIR
+			Biquad,       // 12 dB/octave RBJ biquad with resonance
+			StateVariable // 12 dB/octave trapezoidal state variable filter with resonance
+		};
+
 		enum class MorphCurve {
 			Linear,
 			Exponential,
@@ -26,12 +59,16 @@ namespace WavetableGen {
 			// Distortion
 			DistortionType distortionType = DistortionType::None;
 			float distortionAmount = 0.0f; // 0.0-1.0
+			AntiAliasing antiAliasing = AntiAliasing::Oversampling; // For the aliasing-prone effects
+			OversamplingQuality oversamplingQuality = OversamplingQuality::Standard;
 
 			// Filtering
 			bool enableLowPass = false;
 			float lowPassCutoff = 1.0f; // 0.0-1.0 (fraction of Nyquist)
 			bool enableHighPass = false;
 			float highPassCutoff = 0.0f; // 0.0-1.0
+			FilterType filterType = FilterType::OnePole; // Shape of both filters
+			float filterResonance = 0.707f; // Q of the two-pole filters (0.5-10)
 
 			// Bit crushing
 			bool enableBitCrush = false;
@@ -74,49 +111,87 @@ namespace WavetableGen {
 		};
 
 		// Waveform effects processor with anti-aliasing
+		// Every effect has a std::vector overload and an in-place pointer + length overload, so frames
+		// can be processed directly inside a contiguous wavetable
 		class WaveformEffects {
 		public:
-			// Apply all effects in proper order to avoid aliasing
-			static void ApplyEffects(std::vector<float>& samples, const EffectsSettings& settings);
+			// Apply all effects in proper order to avoid aliasing (through a one-off EffectChain)
+			// seed: drives the randomized effects (phase randomization), so results are reproducible
+			static void ApplyEffects(std::vector<float>& samples, const EffectsSettings& settings, uint64_t seed);
+			static void ApplyEffects(float* samples, size_t numSamples, const EffectsSettings& settings, uint64_t seed);
 
 			// Individual effects (public for flexibility)
 
 			// Safe effects (no oversampling needed)
 			static void ApplyLowPassFilter(std::vector<float>& samples, float cutoff);
+			static void ApplyLowPassFilter(float* samples, size_t numSamples, float cutoff);
 			static void ApplyHighPassFilter(std::vector<float>& samples, float cutoff);
+			static void ApplyHighPassFilter(float* samples, size_t numSamples, float cutoff);
 			static void ApplyMirrorHorizontal(std::vector<float>& samples);
+			static void ApplyMirrorHorizontal(float* samples, size_t numSamples);
 			static void ApplyMirrorVertical(std::vector<float>& samples);
+			static void ApplyMirrorVertical(float* samples, size_t numSamples);
 			static void ApplyInvert(std::vector<float>& samples);
+			static void ApplyInvert(float* samples, size_t numSamples);
 			static void ApplyReverse(std::vector<float>& samples);
+			static void ApplyReverse(float* samples, size_t numSamples);
 
-			// Aliasing-prone effects (use oversampling internally)
+			// Aliasing-prone effects (oversampled by a factor picked from the effect and amount)
+			// scratch: GetNonlinearScratchSize(numSamples) floats, or nullptr for a per-thread buffer
 			static void ApplyDistortion(std::vector<float>& samples, DistortionType type, float amount);
+			static void ApplyDistortion(float* samples, size_t numSamples, DistortionType type, float amount, float* scratch = nullptr);
 			static void ApplyBitCrush(std::vector<float>& samples, int bits);
+			static void ApplyBitCrush(float* samples, size_t numSamples, int bits, float* scratch = nullptr);
 			static void ApplySampleRateReduction(std::vector<float>& samples, int factor);
+			static void ApplySampleRateReduction(float* samples, size_t numSamples, int factor, float* scratch = nullptr);
 			static void ApplyWavefold(std::vector<float>& samples, float amount);
-
-			// Spectral effects (frequency domain processing)
+			static void ApplyWavefold(float* samples, size_t numSamples, float amount, float* scratch = nullptr);
+
+			// Aliasing-prone effects that run together in one oversampled pass
+			// Each member at its default leaves the signal unchanged
+			// With an ADAA mode, distortion and wavefold run at the base rate instead, and only bit
+			// crush and sample rate reduction are oversampled (polyphase)
+			struct NonlinearStage {
+				DistortionType distortionType = DistortionType::None;
+				float distortionAmount = 0.0f;
+				float wavefoldAmount = 0.0f;
+				int bitDepth = 16;
+				int sampleRateReductionFactor = 1;
+				AntiAliasing antiAliasing = AntiAliasing::Oversampling;
+				OversamplingQuality quality = OversamplingQuality::Standard;
+
+				bool IsEmpty() const;
+
+				// 1, 2, 4 or 8: the smallest factor at which every enabled effect meets the quality's
+				// alias target (for an effect that cannot, its least aliasing factor)
+				int GetOversamplingFactor() const;
+			};
+
+			// Floats of caller scratch the aliasing-prone effects need for numSamples samples
+			static size_t GetNonlinearScratchSize(size_t numSamples);
+
+			// Upsample once, apply every enabled nonlinearity per sample, decimate once
+			static void ApplyNonlinearStage(std::vector<float>& samples, const NonlinearStage& stage);
+			static void ApplyNonlinearStage(float* samples, size_t numSamples, const NonlinearStage& stage, float* scratch = nullptr);
+
+			// The nonlinearities themselves (called at the oversampled rate)
+			// factor: oversampling factor of samples
+			static void ProcessOversampled(float* samples, size_t count, const NonlinearStage& stage, int factor);
+
+			// Spectral effects (frequency domain processing, per-thread FFT processor)
 			static void ApplySpectralDecay(std::vector<float>& samples, float amount, float curve);
+			static void ApplySpectralDecay(float* samples, size_t numSamples, float amount, float curve);
 			static void ApplySpectralTilt(std::vector<float>& samples, float amount);
+			static void ApplySpectralTilt(float* samples, size_t numSamples, float amount);
 			static void ApplySpectralGate(std::vector<float>& samples, float threshold);
-			static void ApplyPhaseRandomization(std::vector<float>& samples, float amount);
+			static void ApplySpectralGate(float* samples, size_t numSamples, float threshold);
+			static void ApplyPhaseRandomization(std::vector<float>& samples, float amount, uint64_t seed);
+			static void ApplyPhaseRandomization(float* samples, size_t numSamples, float amount, uint64_t seed);
 			static void ApplySpectralShift(std::vector<float>& samples, int shiftAmount);
+			static void ApplySpectralShift(float* samples, size_t numSamples, int shiftAmount);
 
 			// Morph curve interpolation
 			static float ApplyMorphCurve(float t, MorphCurve curve);
-
-		private:
-			// Oversampling infrastructure
-			static std::vector<float> Oversample4x(const std::vector<float>& input);
-			static std::vector<float> Downsample4x(const std::vector<float>& input);
-
-			// Anti-aliasing filter for downsampling
-			static void ApplyAntiAliasingFilter(std::vector<float>& samples);
-
-			// Low-level distortion implementations (called at oversampled rate)
-			static void ApplySoftDistortion(std::vector<float>& samples, float amount);
-			static void ApplyHardDistortion(std::vector<float>& samples, float amount);
-			static void ApplyAsymmetricDistortion(std::vector<float>& samples, float amount);
 		};
 	}
 }
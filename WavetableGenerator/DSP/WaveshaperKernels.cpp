@@ -0,0 +1,86 @@
+#include "WaveshaperKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WavetableGen {
+	namespace Core {
+		WaveshaperParams WaveshaperParams::FromStage(const WaveformEffects::NonlinearStage& stage) {
+			WaveshaperParams p;
+			p.distortionType = stage.distortionAmount >= 0.001f ? stage.distortionType : DistortionType::None;
+			p.softDrive = 1.0f + stage.distortionAmount * 9.0f;       // 1x to 10x drive
+			p.hardThreshold = 1.0f - stage.distortionAmount * 0.9f;   // Threshold from 1.0 to 0.1
+			p.asymmetricDrive = 1.0f + stage.distortionAmount * 4.0f;
+
+			p.wavefold = stage.wavefoldAmount >= 0.001f;
+			p.foldGain = 1.0f + stage.wavefoldAmount * 3.0f;          // 1x to 4x gain
+
+			p.bitCrush = stage.bitDepth < 16;
+			int levels = 1 << std::max(stage.bitDepth, 1);
+			p.crushStep = 2.0f / (float)levels;
+			p.crushStepInv = (float)levels / 2.0f;
+			return p;
+		}
+
+		WaveshaperKernel WaveshaperKernels::Get() {
+			return Get(Utils::CpuFeatures::GetSimdLevel());
+		}
+
+		WaveshaperKernel WaveshaperKernels::Get(Utils::SimdLevel level) {
+			WaveshaperKernel kernel = nullptr;
+
+			// Fall back to the next lower instruction set if a level was not compiled in
+			switch (level) {
+			case Utils::SimdLevel::AVX512:
+				kernel = GetAVX512();
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::AVX2:
+				kernel = GetAVX2();
+				if (kernel) break;
+				// fallthrough
+			case Utils::SimdLevel::SSE2:
+				kernel = GetSSE2();
+				break;
+			default:
+				break;
+			}
+
+			return kernel ? kernel : ProcessScalar;
+		}
+
+		void WaveshaperKernels::ProcessScalar(float* samples, size_t count, const WaveshaperParams& p) {
+			for (size_t i = 0; i < count; ++i) {
+				float s = samples[i];
+
+				switch (p.distortionType) {
+				case DistortionType::Soft:
+					s = std::tanh(s * p.softDrive);
+					break;
+				case DistortionType::Hard:
+					s = std::min(std::max(s, -p.hardThreshold), p.hardThreshold);
+					break;
+				case DistortionType::Asymmetric:
+					// Asymmetric - less drive on negative
+					s = s * p.asymmetricDrive;
+					s = std::tanh(s > 0.0f ? s : s * 0.5f);
+					break;
+				default:
+					break;
+				}
+
+				if (p.wavefold) {
+					// Triangle folding in closed form (period 4): 1 - |((x + 1) mod 4) - 2|
+					float x = s * p.foldGain + 1.0f;
+					float m = x - std::floor(x * 0.25f) * 4.0f;
+					s = 1.0f - std::abs(m - 2.0f);
+				}
+
+				if (p.bitCrush) {
+					s = std::floor(s * p.crushStepInv) * p.crushStep;
+				}
+
+				samples[i] = s;
+			}
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#ifndef WAVESHAPERKERNELS_H
+#define WAVESHAPERKERNELS_H
+
+#include "WaveformEffects.h"
+#include "../Utils/CpuFeatures.h"
+#include <cstddef>
+
+namespace WavetableGen {
+	namespace Core {
+		// Per-sample parameters of the memoryless nonlinearities in a NonlinearStage, resolved once
+		struct WaveshaperParams {
+			DistortionType distortionType = DistortionType::None; // None when the amount is negligible
+			float softDrive = 1.0f;
+			float hardThreshold = 1.0f;
+			float asymmetricDrive = 1.0f;
+
+			bool wavefold = false;
+			float foldGain = 1.0f;
+
+			bool bitCrush = false;
+			float crushStep = 1.0f;      // Quantization step (a power of two)
+			float crushStepInv = 1.0f;   // 1 / crushStep, exact because the step is a power of two
+
+			// Resolve the stage's amounts into drives, thresholds and steps
+			static WaveshaperParams FromStage(const WaveformEffects::NonlinearStage& stage);
+
+			// True when the kernel would leave the signal unchanged
+			bool IsEmpty() const { return distortionType == DistortionType::None && !wavefold && !bitCrush; }
+		};
+
+		// Distortion, then wavefold, then bit crush, applied in place to count samples
+		typedef void (*WaveshaperKernel)(float* samples, size_t count, const WaveshaperParams& params);
+
+		// Branch-free waveshaping kernels for the oversampled nonlinear stage
+		// Wavefold is a closed-form triangle fold and bit crush multiplies by the inverse step, the
+		// same as the scalar kernel. tanh uses the polynomial approximation from Utils/SimdMath.h
+		// (see GetMaxError). The instruction set is picked at runtime like FastWaveKernels.
+		class WaveshaperKernels {
+		public:
+			// Best kernel for the running CPU
+			static WaveshaperKernel Get();
+
+			// Kernel for a specific instruction set (Scalar, or the next lower level that was compiled in)
+			static WaveshaperKernel Get(Utils::SimdLevel level);
+
+			// Reference kernel (std::tanh)
+			static void ProcessScalar(float* samples, size_t count, const WaveshaperParams& params);
+
+			// Largest absolute difference of a SIMD kernel from ProcessScalar before bit crushing,
+			// measured over inputs in [-4, 4] for every distortion type, amount and fold amount on
+			// every ISA, with and without FMA contraction, with a 2x margin. A shaped value within
+			// this distance of a bit crush step may land on the neighbouring step.
+			static float GetMaxError() { return 2e-6f; }
+
+		private:
+			// One entry point per instruction set (see WaveshaperKernelsSSE2/AVX2/AVX512.cpp)
+			static WaveshaperKernel GetSSE2();
+			static WaveshaperKernel GetAVX2();
+			static WaveshaperKernel GetAVX512();
+		};
+	}
+}
+
+#endif // WAVESHAPERKERNELS_H
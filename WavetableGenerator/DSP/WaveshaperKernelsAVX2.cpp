@@ -0,0 +1,15 @@
+// Compiled with /arch:AVX2 (see WavetableGenerator.vcxproj)
+#include "WaveshaperKernels.h"
+#include "WaveshaperKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveshaperKernel WaveshaperKernels::GetAVX2() {
+#if defined(WTG_HAS_AVX2)
+			return WaveshaperKernelsSimd<Utils::VecAVX2>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,15 @@
+// Compiled with /arch:AVX512 (see WavetableGenerator.vcxproj)
+#include "WaveshaperKernels.h"
+#include "WaveshaperKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveshaperKernel WaveshaperKernels::GetAVX512() {
+#if defined(WTG_HAS_AVX512)
+			return WaveshaperKernelsSimd<Utils::VecAVX512>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
@@ -0,0 +1,15 @@
+// SSE2 is the x64 baseline, so no extra /arch flag is needed
+#include "WaveshaperKernels.h"
+#include "WaveshaperKernelsSimd.h"
+
+namespace WavetableGen {
+	namespace Core {
+		WaveshaperKernel WaveshaperKernels::GetSSE2() {
+#if defined(WTG_HAS_SSE2)
+			return WaveshaperKernelsSimd<Utils::VecSSE2>::Process;
+#else
+			return nullptr;
+#endif
+		}
+	}
+}
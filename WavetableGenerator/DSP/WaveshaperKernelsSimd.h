@@ -0,0 +1,77 @@
+#ifndef WAVESHAPERKERNELSSIMD_H
+#define WAVESHAPERKERNELSSIMD_H
+
+// Instruction-set independent implementation of the waveshaping kernels.
+// Only include this from the per-ISA translation units (WaveshaperKernelsSSE2/AVX2/AVX512.cpp):
+// it is instantiated once per vector type from Utils/SimdVector.h.
+// Like the waveform kernel headers it uses no inline standard library functions.
+
+#include "WaveshaperKernels.h"
+#include "../Utils/SimdVector.h"
+#include "../Utils/SimdMath.h"
+
+namespace WavetableGen {
+	namespace Core {
+		namespace {
+			template <class V>
+			class WaveshaperKernelsSimd {
+				typedef typename V::Reg Reg;
+				typedef Utils::SimdMath<V> M;
+
+			public:
+				// Same operation order as WaveshaperKernels::ProcessScalar
+				static void Process(float* samples, size_t count, const WaveshaperParams& p) {
+					size_t n = 0;
+					for (; n + V::Width <= count; n += V::Width) {
+						V::Store(samples + n, Shape(V::Load(samples + n), p));
+					}
+
+					// Partial last vector
+					if (n < count) {
+						float tail[V::Width] = {};
+						for (size_t i = 0; n + i < count; ++i)
+							tail[i] = samples[n + i];
+						V::Store(tail, Shape(V::Load(tail), p));
+						for (size_t i = 0; n < count; ++n, ++i)
+							samples[n] = tail[i];
+					}
+				}
+
+			private:
+				static Reg Shape(Reg s, const WaveshaperParams& p) {
+					switch (p.distortionType) {
+					case DistortionType::Soft:
+						s = M::Tanh(V::Mul(s, V::Set1(p.softDrive)));
+						break;
+					case DistortionType::Hard:
+						s = V::Min(V::Max(s, V::Set1(-p.hardThreshold)), V::Set1(p.hardThreshold));
+						break;
+					case DistortionType::Asymmetric: {
+						// Less drive on negative
+						Reg driven = V::Mul(s, V::Set1(p.asymmetricDrive));
+						s = M::Tanh(V::Select(V::CmpGt(s, V::Set1(0.0f)), driven, V::Mul(driven, V::Set1(0.5f))));
+						break;
+					}
+					default:
+						break;
+					}
+
+					if (p.wavefold) {
+						// Triangle fold with period 4: 1 - |((x + 1) mod 4) - 2|
+						Reg x = V::Add(V::Mul(s, V::Set1(p.foldGain)), V::Set1(1.0f));
+						Reg m = V::Sub(x, V::Mul(M::Floor(V::Mul(x, V::Set1(0.25f))), V::Set1(4.0f)));
+						s = V::Sub(V::Set1(1.0f), V::Abs(V::Sub(m, V::Set1(2.0f))));
+					}
+
+					if (p.bitCrush) {
+						s = V::Mul(M::Floor(V::Mul(s, V::Set1(p.crushStepInv))), V::Set1(p.crushStep));
+					}
+
+					return s;
+				}
+			};
+		}
+	}
+}
+
+#endif // WAVESHAPERKERNELSSIMD_H
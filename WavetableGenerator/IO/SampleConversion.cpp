@@ -0,0 +1,103 @@
+#include "SampleConversion.h"
+#include "../Utils/SimdVector.h"
+#include <cstring>
+
+namespace WavetableGen {
+	namespace IO {
+		namespace {
+			// Clamp to [-1, 1]; NaN passes through, like Min(1, Max(-1, s)) in the SIMD paths
+			float Clamp(float s) {
+				if (s > 1.0f) s = 1.0f;
+				if (s < -1.0f) s = -1.0f;
+				return s;
+			}
+		}
+
+		bool SampleConversion::IsLittleEndianHost() {
+			const uint16_t probe = 1;
+			unsigned char firstByte;
+			std::memcpy(&firstByte, &probe, 1);
+			return firstByte == 1;
+		}
+
+		void SampleConversion::StoreUInt16LE(unsigned char* output, uint16_t value) {
+			output[0] = value & 0xFF;
+			output[1] = (value >> 8) & 0xFF;
+		}
+
+		void SampleConversion::StoreUInt32LE(unsigned char* output, uint32_t value) {
+			output[0] = value & 0xFF;
+			output[1] = (value >> 8) & 0xFF;
+			output[2] = (value >> 16) & 0xFF;
+			output[3] = (value >> 24) & 0xFF;
+		}
+
+		bool SampleConversion::ToFloat32LE(const float* samples, size_t count, unsigned char* output) {
+			bool anyNonZero = false;
+			size_t i = 0;
+
+			if (IsLittleEndianHost()) {
+#if defined(WTG_HAS_SSE2)
+				typedef Utils::VecSSE2 Vec;
+				const Vec::Reg lo = Vec::Set1(-1.0f);
+				const Vec::Reg hi = Vec::Set1(1.0f);
+				const Vec::Reg zero = Vec::Set1(0.0f);
+				__m128 nonZero = zero;
+				for (; i + Vec::Width <= count; i += Vec::Width) {
+					Vec::Reg s = Vec::Load(samples + i);
+					nonZero = _mm_or_ps(nonZero, _mm_cmpneq_ps(s, zero));
+					_mm_storeu_ps(reinterpret_cast<float*>(output + 4 * i), Vec::Min(hi, Vec::Max(lo, s)));
+				}
+				anyNonZero = _mm_movemask_ps(nonZero) != 0;
+#endif
+				// Native floats are the file's bytes
+				for (; i < count; ++i) {
+					float s = samples[i];
+					anyNonZero |= s != 0.0f;
+					s = Clamp(s);
+					std::memcpy(output + 4 * i, &s, 4);
+				}
+				return anyNonZero;
+			}
+
+			for (; i < count; ++i) {
+				float s = samples[i];
+				anyNonZero |= s != 0.0f;
+				s = Clamp(s);
+				uint32_t rawValue;
+				std::memcpy(&rawValue, &s, 4);
+				StoreUInt32LE(output + 4 * i, rawValue);
+			}
+			return anyNonZero;
+		}
+
+		void SampleConversion::ToPCM16LE(const float* samples, size_t count, unsigned char* output) {
+			size_t i = 0;
+
+			if (IsLittleEndianHost()) {
+#if defined(WTG_HAS_SSE2)
+				typedef Utils::VecSSE2 Vec;
+				const Vec::Reg lo = Vec::Set1(-1.0f);
+				const Vec::Reg hi = Vec::Set1(1.0f);
+				const Vec::Reg scale = Vec::Set1(32767.0f);
+				for (; i + 2 * Vec::Width <= count; i += 2 * Vec::Width) {
+					// Truncate like the scalar cast; the clamped values fit, so the pack never saturates
+					__m128i a = _mm_cvttps_epi32(Vec::Mul(Vec::Min(hi, Vec::Max(lo, Vec::Load(samples + i))), scale));
+					__m128i b = _mm_cvttps_epi32(Vec::Mul(Vec::Min(hi, Vec::Max(lo, Vec::Load(samples + i + Vec::Width))), scale));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * i), _mm_packs_epi32(a, b));
+				}
+#endif
+				for (; i < count; ++i) {
+					int16_t value = static_cast<int16_t>(Clamp(samples[i]) * 32767);
+					std::memcpy(output + 2 * i, &value, 2);
+				}
+				return;
+			}
+
+			for (; i < count; ++i) {
+				int16_t value = static_cast<int16_t>(Clamp(samples[i]) * 32767);
+				StoreUInt16LE(output + 2 * i, static_cast<uint16_t>(value));
+			}
+		}
+	}
+}
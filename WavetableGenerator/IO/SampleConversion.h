@@ -0,0 +1,34 @@
+#ifndef SAMPLECONVERSION_H
+#define SAMPLECONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace WavetableGen {
+	namespace IO {
+		// Bulk sample encoding for the file writers (Single Responsibility Principle)
+		// Converts a whole table into the file's byte layout in one pass, so a writer can emit
+		// header and data with a single write. Both formats are little-endian: on little-endian
+		// hosts the converted values are stored as is (SSE2 on x64), other hosts get a portable
+		// byte-by-byte path.
+		class SampleConversion {
+		public:
+			// True when the host stores multi-byte values little-endian
+			static bool IsLittleEndianHost();
+
+			// Samples clamped to [-1, 1] as 32-bit little-endian floats (4 * count bytes)
+			// Returns false if every sample is zero
+			static bool ToFloat32LE(const float* samples, size_t count, unsigned char* output);
+
+			// Samples clamped to [-1, 1] as 16-bit little-endian PCM (2 * count bytes), scaled
+			// by 32767 and truncated
+			static void ToPCM16LE(const float* samples, size_t count, unsigned char* output);
+
+			// Portable little-endian stores for header fields
+			static void StoreUInt16LE(unsigned char* output, uint16_t value);
+			static void StoreUInt32LE(unsigned char* output, uint32_t value);
+		};
+	}
+}
+
+#endif // SAMPLECONVERSION_H
@@ -2,11 +2,11 @@
 #define WAVFILEWRITER_H
 
 #include "IFileWriter.h"
-#include <fstream>
 
 namespace WavetableGen {
 	namespace IO {
 		// Writes audio files in WAV format
+		// The whole file is encoded into one buffer and written with a single call
 		class WAVFileWriter : public IFileWriter {
 		public:
 			WAVFileWriter() = default;
@@ -17,11 +17,6 @@ namespace WavetableGen {
 				const std::vector<float>& samples,
 				int numFrames,
 				uint32_t sampleRate = 44100) override;
-
-		private:
-			// Helper methods to write binary data in little-endian format (portable)
-			static void WriteUInt16(std::ofstream& file, uint16_t value);
-			static void WriteUInt32(std::ofstream& file, uint32_t value);
 		};
 	}
 }
@@ -1,29 +1,13 @@
 #include "WTFileWriter.h"
+#include "SampleConversion.h"
 #include "../Core/WaveGenerator.h"  // For SAMPLES_PER_WAVE constant
 #include <cstring>
+#include <fstream>
 
 namespace WavetableGen {
 	namespace IO {
 		using namespace Core;
 
-		// Portable helper: Write 32-bit unsigned integer in little-endian format
-		void WTFileWriter::WriteUInt32(std::ofstream& file, uint32_t value) {
-			unsigned char bytes[4];
-			bytes[0] = value & 0xFF;
-			bytes[1] = (value >> 8) & 0xFF;
-			bytes[2] = (value >> 16) & 0xFF;
-			bytes[3] = (value >> 24) & 0xFF;
-			file.write(reinterpret_cast<const char*>(bytes), 4);
-		}
-
-		// Portable helper: Write 32-bit float in little-endian format
-		void WTFileWriter::WriteFloat32(std::ofstream& file, float value) {
-			// Reinterpret float as uint32_t to get raw bytes
-			uint32_t rawValue;
-			std::memcpy(&rawValue, &value, sizeof(float));
-			WriteUInt32(file, rawValue);
-		}
-
 		// Write wavetable in .wt format (Serum/Bitwig format, portable - no struct packing required)
 		GenerationResult WTFileWriter::Write(
 			const std::string& filename,
@@ -36,13 +20,21 @@ namespace WavetableGen {
 				return GenerationResult::ErrorInvalidSampleCount;
 			}
 
-			// Validate: check if samples contain valid data
-			int zeroCount = 0;
-			for (float s : samples) {
-				if (s == 0.0f) zeroCount++;
-			}
+			// .wt header (12 bytes total), then the samples
+			const size_t headerSize = 12;
+			std::vector<unsigned char> buffer(headerSize + samples.size() * 4);
+
+			// Magic number: "vawt" (4 bytes)
+			std::memcpy(buffer.data(), "vawt", 4);
+
+			// Samples per frame: 2048 (4 bytes, uint32_t)
+			SampleConversion::StoreUInt32LE(buffer.data() + 4, SAMPLES_PER_WAVE);
 
-			if (zeroCount == samples.size()) {
+			// Number of frames (4 bytes, uint32_t)
+			SampleConversion::StoreUInt32LE(buffer.data() + 8, static_cast<uint32_t>(numFrames));
+
+			// 32-bit float samples, clamped; the same pass checks that they contain valid data
+			if (!SampleConversion::ToFloat32LE(samples.data(), samples.size(), buffer.data() + headerSize)) {
 				return GenerationResult::ErrorAllSamplesZero;
 			}
 
@@ -51,22 +43,7 @@ namespace WavetableGen {
 				return GenerationResult::ErrorFileOpenFailed;
 			}
 
-			// Write .wt header (12 bytes total)
-			// Magic number: "vawt" (4 bytes)
-			file.write("vawt", 4);
-
-			// Samples per frame: 2048 (4 bytes, uint32_t)
-			WriteUInt32(file, SAMPLES_PER_WAVE);
-
-			// Number of frames (4 bytes, uint32_t)
-			WriteUInt32(file, static_cast<uint32_t>(numFrames));
-
-			// Write 32-bit float samples
-			for (float s : samples) {
-				if (s > 1.0f) s = 1.0f;
-				if (s < -1.0f) s = -1.0f;
-				WriteFloat32(file, s);
-			}
+			file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
 
 			return GenerationResult::Success;
 		}
@@ -2,11 +2,11 @@
 #define WTFILEWRITER_H
 
 #include "IFileWriter.h"
-#include <fstream>
 
 namespace WavetableGen {
 	namespace IO {
 		// Writes wavetables in .wt format (Serum/Bitwig format)
+		// The whole file is encoded into one buffer and written with a single call
 		class WTFileWriter : public IFileWriter {
 		public:
 			WTFileWriter() = default;
@@ -17,11 +17,6 @@ namespace WavetableGen {
 				const std::vector<float>& samples,
 				int numFrames,
 				uint32_t sampleRate = 44100) override;
-
-		private:
-			// Helper methods to write binary data in little-endian format (portable)
-			static void WriteUInt32(std::ofstream& file, uint32_t value);
-			static void WriteFloat32(std::ofstream& file, float value);
 		};
 	}
 }
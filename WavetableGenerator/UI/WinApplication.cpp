@@ -1141,7 +1141,7 @@ namespace WavetableGen {
 			ThreadData* pData = reinterpret_cast<ThreadData*>(lpParam);
 			WinApplication* pApp = pData->pApp;
 
-			// Generate multiple random wavetables
+			// Generate multiple random wavetables (one worker per hardware thread)
 			pApp->m_randomGenerator.GenerateBatch(
 				pData->outputFolder, pData->count, pData->minWaves, pData->maxWaves,
 				pData->availableWaveforms, pData->extension.c_str(), pData->format, pData->isAudioPreview,
@@ -1156,7 +1156,8 @@ namespace WavetableGen {
 					int progress = (generated * 100) / total;
 					PostMessage(pApp->m_hwnd, WM_GENERATION_PROGRESS, progress, generated);
 					return true; // Continue generation
-				}
+				},
+				0
 			);
 
 			// Send completion message
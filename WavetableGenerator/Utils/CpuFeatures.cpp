@@ -0,0 +1,91 @@
+#include "CpuFeatures.h"
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define WTG_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace WavetableGen {
+	namespace Utils {
+#if defined(WTG_X86)
+		// Portable helper: Query CPUID leaf/subleaf into eax, ebx, ecx, edx
+		static void CpuId(unsigned leaf, unsigned subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuidex(info, (int)leaf, (int)subleaf);
+			for (int i = 0; i < 4; ++i) regs[i] = (uint32_t)info[i];
+#else
+			unsigned a = 0, b = 0, c = 0, d = 0;
+			__cpuid_count(leaf, subleaf, a, b, c, d);
+			regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+#endif
+		}
+
+		// Portable helper: Read an extended control register (which register states the OS saves)
+		static uint64_t XGetBV(unsigned index) {
+#if defined(_MSC_VER)
+			return _xgetbv(index);
+#else
+			uint32_t eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+			return ((uint64_t)edx << 32) | eax;
+#endif
+		}
+#endif
+
+		SimdLevel CpuFeatures::DetectSimdLevel() {
+#if defined(WTG_X86)
+			uint32_t regs[4];
+			CpuId(0, 0, regs);
+			uint32_t maxLeaf = regs[0];
+
+			CpuId(1, 0, regs);
+			bool sse2 = (regs[3] & (1u << 26)) != 0;
+			bool fma = (regs[2] & (1u << 12)) != 0;
+			bool osxsave = (regs[2] & (1u << 27)) != 0;
+			bool avx = (regs[2] & (1u << 28)) != 0;
+
+			if (!sse2) return SimdLevel::Scalar;
+			if (!osxsave || !avx || maxLeaf < 7) return SimdLevel::SSE2;
+
+			// The OS must save XMM/YMM state (and opmask/ZMM state for AVX-512)
+			uint64_t xcr0 = XGetBV(0);
+			bool osAvx = (xcr0 & 0x6) == 0x6;
+			bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+			CpuId(7, 0, regs);
+			bool avx2 = (regs[1] & (1u << 5)) != 0;
+			bool avx512 = (regs[1] & (1u << 16)) != 0  // F
+				&& (regs[1] & (1u << 17)) != 0           // DQ
+				&& (regs[1] & (1u << 28)) != 0           // CD
+				&& (regs[1] & (1u << 30)) != 0           // BW
+				&& (regs[1] & (1u << 31)) != 0;          // VL
+
+			if (!osAvx || !avx2 || !fma) return SimdLevel::SSE2;
+			if (!osAvx512 || !avx512) return SimdLevel::AVX2;
+			return SimdLevel::AVX512;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		SimdLevel CpuFeatures::GetSimdLevel() {
+			static const SimdLevel level = DetectSimdLevel();
+			return level;
+		}
+
+		const char* CpuFeatures::GetSimdLevelName(SimdLevel level) {
+			switch (level) {
+			case SimdLevel::SSE2: return "SSE2";
+			case SimdLevel::AVX2: return "AVX2";
+			case SimdLevel::AVX512: return "AVX-512";
+			default: return "Scalar";
+			}
+		}
+	}
+}
@@ -0,0 +1,30 @@
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+namespace WavetableGen {
+	namespace Utils {
+		// Instruction set levels used for runtime kernel dispatch (ordered from slowest to fastest)
+		enum class SimdLevel {
+			Scalar,
+			SSE2,
+			AVX2,     // AVX2 + FMA
+			AVX512    // AVX-512 F/CD/BW/DQ/VL
+		};
+
+		// Runtime CPU feature detection (CPUID + XGETBV)
+		class CpuFeatures {
+		public:
+			// Highest instruction set supported by both the CPU and the operating system
+			// (detected once, then cached)
+			static SimdLevel GetSimdLevel();
+
+			// Human-readable name of an instruction set level
+			static const char* GetSimdLevelName(SimdLevel level);
+
+		private:
+			static SimdLevel DetectSimdLevel();
+		};
+	}
+}
+
+#endif // CPUFEATURES_H
@@ -0,0 +1,133 @@
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+// Vectorized math shared by the SIMD waveform kernels, written once against the wrappers in
+// SimdVector.h. Like SimdVector.h it lives in an anonymous namespace and uses no standard library
+// functions, so each per-ISA translation unit gets its own copy.
+
+#include <cstddef>
+#include "SimdVector.h"
+
+namespace WavetableGen {
+	namespace Utils {
+		namespace {
+			template <class V>
+			struct SimdMath {
+				typedef typename V::Reg Reg;
+
+			// Evaluate fn(t) for every sample, where t = n / numSamples is the normalized phase
+			template <class Fn>
+			static void Render(float* output, size_t numSamples, Fn fn) {
+				const Reg count = V::Set1((float)numSamples);
+				const Reg step = V::Set1((float)V::Width);
+				Reg index = V::Iota(); // Exact while numSamples < 2^24
+
+				size_t n = 0;
+				for (; n + V::Width <= numSamples; n += V::Width) {
+					V::Store(output + n, fn(V::Div(index, count)));
+					index = V::Add(index, step);
+				}
+
+				// Partial last vector
+				if (n < numSamples) {
+					float tail[V::Width];
+					V::Store(tail, fn(V::Div(index, count)));
+					for (size_t i = 0; n < numSamples; ++n, ++i)
+						output[n] = tail[i];
+				}
+			}
+
+			// Accumulate fn(t) into every sample: output[n] += fn(n / numSamples)
+			template <class Fn>
+			static void RenderAdd(float* output, size_t numSamples, Fn fn) {
+				const Reg count = V::Set1((float)numSamples);
+				const Reg step = V::Set1((float)V::Width);
+				Reg index = V::Iota();
+
+				size_t n = 0;
+				for (; n + V::Width <= numSamples; n += V::Width) {
+					V::Store(output + n, V::Add(V::Load(output + n), fn(V::Div(index, count))));
+					index = V::Add(index, step);
+				}
+
+				if (n < numSamples) {
+					float tail[V::Width];
+					V::Store(tail, fn(V::Div(index, count)));
+					for (size_t i = 0; n < numSamples; ++n, ++i)
+						output[n] += tail[i];
+				}
+			}
+
+			// x - trunc(x): same result as fmodf(x, 1.0f), including for negative x
+			static Reg Fmod1(Reg x) {
+				return V::Sub(x, V::Trunc(x));
+			}
+
+			// Round toward negative infinity (valid for |x| < 2^31)
+			static Reg Floor(Reg x) {
+				Reg t = V::Trunc(x);
+				return V::Select(V::CmpGt(t, x), V::Sub(t, V::Set1(1.0f)), t);
+			}
+
+			// sin(2*PI*x) for x in turns: reduce to [-0.25, 0.25] turns, then a degree-13 Taylor polynomial
+			static Reg SinTurns(Reg x) {
+				const Reg quarter = V::Set1(0.25f);
+				const Reg half = V::Set1(0.5f);
+				Reg r = V::Sub(x, V::Round(x));
+				r = V::Select(V::CmpGt(r, quarter), V::Sub(half, r), r);
+				r = V::Select(V::CmpLt(r, V::Set1(-0.25f)), V::Sub(V::Set1(-0.5f), r), r);
+
+				Reg z = V::Mul(r, V::Set1(6.28318530717958647692f));
+				Reg z2 = V::Mul(z, z);
+				Reg poly = V::Set1(1.0f / 6227020800.0f);
+				poly = V::Add(V::Mul(poly, z2), V::Set1(-1.0f / 39916800.0f));
+				poly = V::Add(V::Mul(poly, z2), V::Set1(1.0f / 362880.0f));
+				poly = V::Add(V::Mul(poly, z2), V::Set1(-1.0f / 5040.0f));
+				poly = V::Add(V::Mul(poly, z2), V::Set1(1.0f / 120.0f));
+				poly = V::Add(V::Mul(poly, z2), V::Set1(-1.0f / 6.0f));
+				return V::Add(z, V::Mul(V::Mul(z, z2), poly));
+			}
+
+			// Branch-free WaveKernels::PolyBLEP (same operation order, so results match bit for bit)
+			static Reg PolyBLEP(Reg t, Reg dt, Reg oneMinusDt) {
+				const Reg one = V::Set1(1.0f);
+				Reg u = V::Div(t, dt);
+				Reg head = V::Sub(V::Sub(V::Add(u, u), V::Mul(u, u)), one);
+				Reg v = V::Div(V::Sub(t, one), dt);
+				Reg tail = V::Add(V::Add(V::Add(V::Mul(v, v), v), v), one);
+				return V::Select(V::CmpLt(t, dt), head,
+					V::Select(V::CmpGt(t, oneMinusDt), tail, V::Set1(0.0f)));
+			}
+
+
+			// e^x: 2^n * 2^f with n = round(x * log2(e)) and a degree-6 Taylor polynomial for 2^f
+			// (|f| <= 0.5, relative error below 2e-7; x is clamped to [-87, 87])
+			static Reg Exp(Reg x) {
+				x = V::Min(V::Max(x, V::Set1(-87.0f)), V::Set1(87.0f));
+				Reg y = V::Mul(x, V::Set1(1.44269504088896341f));
+				Reg n = V::Round(y);
+				Reg f = V::Mul(V::Sub(y, n), V::Set1(0.693147180559945309f));
+
+				Reg poly = V::Set1(1.0f / 720.0f);
+				poly = V::Add(V::Mul(poly, f), V::Set1(1.0f / 120.0f));
+				poly = V::Add(V::Mul(poly, f), V::Set1(1.0f / 24.0f));
+				poly = V::Add(V::Mul(poly, f), V::Set1(1.0f / 6.0f));
+				poly = V::Add(V::Mul(poly, f), V::Set1(0.5f));
+				poly = V::Add(V::Mul(poly, f), V::Set1(1.0f));
+				poly = V::Add(V::Mul(poly, f), V::Set1(1.0f));
+				return V::Mul(poly, V::Pow2Int(n));
+			}
+
+			// tanh(x) = 1 - 2 / (e^(2x) + 1) (absolute error below 3e-7; saturates beyond |x| = 9)
+			static Reg Tanh(Reg x) {
+				x = V::Min(V::Max(x, V::Set1(-9.0f)), V::Set1(9.0f));
+				const Reg one = V::Set1(1.0f);
+				Reg e = Exp(V::Add(x, x));
+				return V::Sub(one, V::Div(V::Set1(2.0f), V::Add(e, one)));
+			}
+			};
+		}
+	}
+}
+
+#endif // SIMDMATH_H
@@ -0,0 +1,134 @@
+#ifndef SIMDVECTOR_H
+#define SIMDVECTOR_H
+
+// Thin wrappers over SSE2 / AVX2 / AVX-512 float vectors so that kernels can be written once
+// as templates and instantiated per instruction set. Each wrapper is only available when the
+// including translation unit is compiled for that instruction set (see the *SSE2/*AVX2/*AVX512
+// .cpp files, which carry per-file /arch flags).
+//
+// Everything lives in an anonymous namespace: code compiled with different /arch flags must
+// never share an externally visible inline function, or the linker may pick the AVX copy for
+// a caller running on a CPU without AVX.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WTG_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define WTG_HAS_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+#define WTG_HAS_AVX512 1
+#include <immintrin.h>
+#endif
+
+namespace WavetableGen {
+	namespace Utils {
+		namespace {
+#if defined(WTG_HAS_SSE2)
+			// 4 x float (SSE2)
+			struct VecSSE2 {
+				typedef __m128 Reg;
+				typedef __m128 Mask;
+				static const int Width = 4;
+
+				static Reg Set1(float v) { return _mm_set1_ps(v); }
+				static Reg Iota() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+				static Reg Load(const float* p) { return _mm_loadu_ps(p); }
+				static void Store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+
+				static Reg Add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+				static Reg Sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+				static Reg Mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+				static Reg Div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+				static Reg Min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+				static Reg Max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+				static Reg Abs(Reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+				static Reg Sqrt(Reg a) { return _mm_sqrt_ps(a); }
+
+				// Round toward zero / to nearest even (valid for |a| < 2^31)
+				static Reg Trunc(Reg a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+				static Reg Round(Reg a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+
+				// 2^n for integer-valued n in [-126, 127] (built directly in the exponent field)
+				static Reg Pow2Int(Reg n) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)); }
+
+				static Mask CmpLt(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+				static Mask CmpGt(Reg a, Reg b) { return _mm_cmpgt_ps(a, b); }
+				// mask ? a : b
+				static Reg Select(Mask m, Reg a, Reg b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+			};
+#endif
+
+#if defined(WTG_HAS_AVX2)
+			// 8 x float (AVX2 + FMA)
+			struct VecAVX2 {
+				typedef __m256 Reg;
+				typedef __m256 Mask;
+				static const int Width = 8;
+
+				static Reg Set1(float v) { return _mm256_set1_ps(v); }
+				static Reg Iota() { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+				static Reg Load(const float* p) { return _mm256_loadu_ps(p); }
+				static void Store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+
+				static Reg Add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+				static Reg Sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+				static Reg Mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+				static Reg Div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+				static Reg Min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+				static Reg Max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+				static Reg Abs(Reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+				static Reg Sqrt(Reg a) { return _mm256_sqrt_ps(a); }
+
+				static Reg Trunc(Reg a) { return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+				static Reg Round(Reg a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static Reg Pow2Int(Reg n) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23)); }
+
+				static Mask CmpLt(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+				static Mask CmpGt(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+				static Reg Select(Mask m, Reg a, Reg b) { return _mm256_blendv_ps(b, a, m); }
+			};
+#endif
+
+#if defined(WTG_HAS_AVX512)
+			// 16 x float (AVX-512 F/DQ)
+			struct VecAVX512 {
+				typedef __m512 Reg;
+				typedef __mmask16 Mask;
+				static const int Width = 16;
+
+				static Reg Set1(float v) { return _mm512_set1_ps(v); }
+				static Reg Iota() {
+					return _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f,
+						8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+				}
+				static Reg Load(const float* p) { return _mm512_loadu_ps(p); }
+				static void Store(float* p, Reg v) { _mm512_storeu_ps(p, v); }
+
+				static Reg Add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+				static Reg Sub(Reg a, Reg b) { return _mm512_sub_ps(a, b); }
+				static Reg Mul(Reg a, Reg b) { return _mm512_mul_ps(a, b); }
+				static Reg Div(Reg a, Reg b) { return _mm512_div_ps(a, b); }
+				static Reg Min(Reg a, Reg b) { return _mm512_min_ps(a, b); }
+				static Reg Max(Reg a, Reg b) { return _mm512_max_ps(a, b); }
+				static Reg Abs(Reg a) { return _mm512_andnot_ps(_mm512_set1_ps(-0.0f), a); }
+				static Reg Sqrt(Reg a) { return _mm512_sqrt_ps(a); }
+
+				static Reg Trunc(Reg a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+				static Reg Round(Reg a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static Reg Pow2Int(Reg n) { return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127)), 23)); }
+
+				static Mask CmpLt(Reg a, Reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+				static Mask CmpGt(Reg a, Reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+				static Reg Select(Mask m, Reg a, Reg b) { return _mm512_mask_blend_ps(m, b, a); }
+			};
+#endif
+		}
+	}
+}
+
+#endif // SIMDVECTOR_H
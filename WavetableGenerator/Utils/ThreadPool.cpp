@@ -0,0 +1,171 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <exception>
+
+namespace WavetableGen {
+	namespace Utils {
+		namespace {
+			// Pool and queue owned by the current thread (set once in each worker)
+			thread_local const void* t_pool = nullptr;
+			thread_local size_t t_queue = SIZE_MAX;
+		}
+
+		ThreadPool::ThreadPool(size_t numThreads)
+			: m_queued(0)
+			, m_nextQueue(0)
+			, m_stop(false) {
+			if (numThreads == SIZE_MAX) {
+				// The calling thread takes part in every loop, so leave one hardware thread for it
+				unsigned hardwareThreads = std::thread::hardware_concurrency();
+				numThreads = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+			}
+
+			for (size_t i = 0; i < numThreads; ++i)
+				m_queues.emplace_back(new WorkQueue());
+			for (size_t i = 0; i < numThreads; ++i)
+				m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+		}
+
+		ThreadPool::~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(m_wakeMutex);
+				m_stop = true;
+			}
+			m_wake.notify_all();
+			for (auto& thread : m_threads)
+				thread.join();
+		}
+
+		ThreadPool& ThreadPool::GetShared() {
+			static ThreadPool pool;
+			return pool;
+		}
+
+		void ThreadPool::WorkerLoop(size_t index) {
+			t_pool = this;
+			t_queue = index;
+
+			for (;;) {
+				Task task;
+				if (TryTake(index, task)) {
+					task();
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(m_wakeMutex);
+				m_wake.wait(lock, [this]() { return m_stop || m_queued.load() > 0; });
+				if (m_stop) return;
+			}
+		}
+
+		void ThreadPool::Push(size_t queueIndex, Task task, const void* group) {
+			WorkQueue& queue = *m_queues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			QueuedTask queued;
+			queued.run = std::move(task);
+			queued.group = group;
+			queue.tasks.push_back(std::move(queued));
+			m_queued++;
+		}
+
+		bool ThreadPool::TryTake(size_t home, Task& task, const void* group) {
+			const size_t numQueues = m_queues.size();
+
+			// Remove the newest (fromBack) or oldest matching task of one queue
+			auto take = [this, &task, group](WorkQueue& queue, bool fromBack) {
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				const size_t count = queue.tasks.size();
+				for (size_t i = 0; i < count; ++i) {
+					auto it = queue.tasks.begin() + (fromBack ? count - 1 - i : i);
+					if (group && it->group != group) continue;
+
+					task = std::move(it->run);
+					queue.tasks.erase(it);
+					m_queued--;
+					return true;
+				}
+				return false;
+			};
+
+			// Own queue first, newest task (its data is most likely still in cache)
+			if (home < numQueues && take(*m_queues[home], true))
+				return true;
+
+			// Steal the oldest task of another queue
+			size_t start = home < numQueues ? home + 1 : 0;
+			for (size_t i = 0; i < numQueues; ++i) {
+				if (take(*m_queues[(start + i) % numQueues], false))
+					return true;
+			}
+
+			return false;
+		}
+
+		size_t ThreadPool::GetCallerQueue() const {
+			return t_pool == this ? t_queue : SIZE_MAX;
+		}
+
+		void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grain,
+			const std::function<void(size_t, size_t)>& body) {
+			if (end <= begin) return;
+			grain = (std::max)(grain, (size_t)1);
+
+			const size_t numChunks = (end - begin + grain - 1) / grain;
+			if (m_threads.empty() || numChunks == 1) {
+				body(begin, end);
+				return;
+			}
+
+			// Completion state shared by the chunks of this loop (lives on the caller's stack)
+			struct Group {
+				std::mutex mutex;
+				std::condition_variable done;
+				std::atomic<size_t> remaining;
+				std::exception_ptr error;
+			} group;
+			group.remaining = numChunks;
+
+			// A worker keeps its chunks local (idle workers steal them); other callers spread them out
+			const size_t home = GetCallerQueue();
+			for (size_t first = begin; first < end; first += grain) {
+				size_t last = (std::min)(first + grain, end);
+				size_t queueIndex = home != SIZE_MAX ? home : m_nextQueue++ % m_queues.size();
+
+				Push(queueIndex, [&group, &body, first, last]() {
+					try {
+						body(first, last);
+					}
+					catch (...) {
+						std::lock_guard<std::mutex> lock(group.mutex);
+						if (!group.error) group.error = std::current_exception();
+					}
+
+					// Decrement under the lock: the caller cannot return (and destroy 'group') until we release it
+					std::lock_guard<std::mutex> lock(group.mutex);
+					if (--group.remaining == 0)
+						group.done.notify_all();
+				}, &group);
+			}
+
+			// Taking the wake mutex orders this notify after any worker's predicate check (no lost wake-up)
+			{
+				std::lock_guard<std::mutex> lock(m_wakeMutex);
+			}
+			m_wake.notify_all();
+
+			// Help out instead of blocking, but only with this loop's chunks: running another task here
+			// would nest unrelated work (a whole table generation in a batch) inside this wait
+			Task task;
+			while (group.remaining.load() > 0 && TryTake(home, task, &group)) {
+				task();
+				task = nullptr;
+			}
+
+			std::unique_lock<std::mutex> lock(group.mutex);
+			group.done.wait(lock, [&group]() { return group.remaining.load() == 0; });
+
+			if (group.error)
+				std::rethrow_exception(group.error);
+		}
+	}
+}
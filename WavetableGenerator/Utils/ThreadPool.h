@@ -0,0 +1,81 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <cstdint>
+
+namespace WavetableGen {
+	namespace Utils {
+		// Work-stealing thread pool (Single Responsibility Principle)
+		// Every worker owns a task deque: it takes its own work from the back and steals from the
+		// front of the other deques when it runs dry. Threads waiting on ParallelFor run the loop's
+		// own queued chunks instead of blocking, so parallel loops may be nested (e.g. frames inside
+		// files) without a wait picking up unrelated work such as another file.
+		class ThreadPool {
+		public:
+			// numThreads: worker threads in addition to the calling thread
+			// (SIZE_MAX = one less than the hardware thread count)
+			explicit ThreadPool(size_t numThreads = SIZE_MAX);
+			~ThreadPool();
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator=(const ThreadPool&) = delete;
+
+			// Process-wide pool sized to the machine (created on first use)
+			static ThreadPool& GetShared();
+
+			// Threads that can run a parallel loop: the workers plus the calling thread
+			size_t GetConcurrency() const { return m_threads.size() + 1; }
+
+			// Run body(first, last) over [begin, end) in chunks of at most 'grain' indices and wait
+			// for all of them. Chunks run in any order on any thread, including the caller.
+			// The first exception thrown by a chunk is rethrown here once every chunk has finished.
+			void ParallelFor(size_t begin, size_t end, size_t grain,
+				const std::function<void(size_t, size_t)>& body);
+
+		private:
+			typedef std::function<void()> Task;
+
+			// A task and the ParallelFor call it belongs to
+			struct QueuedTask {
+				Task run;
+				const void* group;
+			};
+
+			struct WorkQueue {
+				std::mutex mutex;
+				std::deque<QueuedTask> tasks;
+			};
+
+			void WorkerLoop(size_t index);
+
+			// Queue a task of 'group' on one worker's deque
+			void Push(size_t queueIndex, Task task, const void* group);
+
+			// Take a task from the queue at 'home' (back), or steal one from any other queue (front)
+			// group: only take tasks of this group (nullptr = any task)
+			bool TryTake(size_t home, Task& task, const void* group = nullptr);
+
+			// Queue owned by the calling thread, or SIZE_MAX if it is not one of our workers
+			size_t GetCallerQueue() const;
+
+			std::vector<std::unique_ptr<WorkQueue>> m_queues;
+			std::vector<std::thread> m_threads;
+
+			std::mutex m_wakeMutex;
+			std::condition_variable m_wake;
+			std::atomic<size_t> m_queued;
+			std::atomic<size_t> m_nextQueue;
+			bool m_stop;
+		};
+	}
+}
+
+#endif // THREADPOOL_H
@@ -23,6 +23,12 @@ namespace WavetableGen {
 				m_state[1] = splitmix64(m_state[0]);
 			}
 
+			// Generator that always follows from seed: 0 maps to a fixed non-zero seed instead of
+			// the clock, so seeded callers stay reproducible whatever seed they are given
+			static XorShift128Plus FromSeed(uint64_t seed) {
+				return XorShift128Plus(seed != 0 ? seed : splitmix64(0));
+			}
+
 			// Generate next random uint64_t
 			uint64_t Next() {
 				uint64_t s1 = m_state[0];
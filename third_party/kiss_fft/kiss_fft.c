@@ -196,49 +196,47 @@ void kiss_fftr_free(kiss_fftr_cfg cfg) {
 void kiss_fftr(kiss_fftr_cfg st, const float* timedata, kiss_fft_cpx* freqdata) {
     int ncfft = st->nfft / 2;
 
-    /* Pack real data into complex (interleaved even/odd samples) */
+    /* Pack real data into complex (even samples -> real, odd samples -> imaginary) */
     for (int i = 0; i < ncfft; i++) {
         st->tmpbuf[i].r = timedata[2 * i];
         st->tmpbuf[i].i = timedata[2 * i + 1];
     }
 
-    /* Perform complex FFT on half-size */
+    /* Perform complex FFT on half-size, then keep a copy: the split below reads bins k and
+       ncfft-k together, so it must not read from the array it is writing */
     kiss_fft(st->substate, st->tmpbuf, freqdata);
+    memcpy(st->tmpbuf, freqdata, sizeof(kiss_fft_cpx) * ncfft);
 
-    /* Post-process to get full spectrum */
-    freqdata[ncfft].r = freqdata[0].r - freqdata[0].i;
-    freqdata[ncfft].i = 0.0f;
-    freqdata[0].r = freqdata[0].r + freqdata[0].i;
+    /* DC and Nyquist */
+    freqdata[0].r = st->tmpbuf[0].r + st->tmpbuf[0].i;
     freqdata[0].i = 0.0f;
+    freqdata[ncfft].r = st->tmpbuf[0].r - st->tmpbuf[0].i;
+    freqdata[ncfft].i = 0.0f;
 
     for (int k = 1; k < ncfft; k++) {
-        kiss_fft_cpx fpk = freqdata[k];
-        kiss_fft_cpx fpnk = freqdata[ncfft - k];
+        kiss_fft_cpx fpk = st->tmpbuf[k];
+        kiss_fft_cpx fpnk = st->tmpbuf[ncfft - k];
         kiss_fft_cpx f1k, f2k, tw;
 
-        /* Unpack to get actual spectrum */
+        /* Even part: (Z[k] + conj(Z[N/2-k])) / 2, odd part: -i * (Z[k] - conj(Z[N/2-k])) / 2 */
         f1k.r = (fpk.r + fpnk.r) * 0.5f;
         f1k.i = (fpk.i - fpnk.i) * 0.5f;
         f2k.r = (fpk.i + fpnk.i) * 0.5f;
         f2k.i = (fpnk.r - fpk.r) * 0.5f;
 
+        /* X[k] = even + e^(-2*pi*i*k/N) * odd */
         C_MUL(&tw, f2k, st->super_twiddles[k]);
         freqdata[k].r = f1k.r + tw.r;
         freqdata[k].i = f1k.i + tw.i;
-        freqdata[ncfft - k].r = f1k.r - tw.r;
-        freqdata[ncfft - k].i = tw.i - f1k.i;
     }
 }
 
-/* Real inverse FFT */
+/* Real inverse FFT (scaled by 1/nfft, so kiss_fftri(kiss_fftr(x)) == x) */
 void kiss_fftri(kiss_fftr_cfg st, const kiss_fft_cpx* freqdata, float* timedata) {
     int ncfft = st->nfft / 2;
 
-    /* Pre-process spectrum */
-    st->tmpbuf[0].r = freqdata[0].r + freqdata[ncfft].r;
-    st->tmpbuf[0].i = freqdata[0].r - freqdata[ncfft].r;
-
-    for (int k = 1; k < ncfft; k++) {
+    /* Rebuild the half-size complex spectrum Z[k] = even[k] + i * odd[k] */
+    for (int k = 0; k < ncfft; k++) {
         kiss_fft_cpx fk = freqdata[k];
         kiss_fft_cpx fnkc;
         fnkc.r = freqdata[ncfft - k].r;
@@ -247,28 +245,17 @@ void kiss_fftri(kiss_fftr_cfg st, const kiss_fft_cpx* freqdata, float* timedata)
         kiss_fft_cpx f1k, f2k, tw;
         f1k.r = (fk.r + fnkc.r) * 0.5f;
         f1k.i = (fk.i + fnkc.i) * 0.5f;
-        f2k.r = (fk.i - fnkc.i) * 0.5f;
-        f2k.i = (fnkc.r - fk.r) * 0.5f;
-
-        /* Conjugate twiddle for inverse */
-        kiss_fft_cpx tw_conj = st->super_twiddles[k];
-        tw_conj.i = -tw_conj.i;
-        C_MUL(&tw, f2k, tw_conj);
+        f2k.r = (fk.r - fnkc.r) * 0.5f;
+        f2k.i = (fk.i - fnkc.i) * 0.5f;
 
-        st->tmpbuf[k].r = f1k.r + tw.r;
-        st->tmpbuf[k].i = f1k.i + tw.i;
-    }
-
-    /* Perform complex inverse FFT */
-    kiss_fft_cpx* tmp2 = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * ncfft);
-    kiss_fft(st->substate, st->tmpbuf, tmp2);
+        /* odd[k] = (X[k] - conj(X[N/2-k])) / 2 * e^(+2*pi*i*k/N) (super twiddles are already conjugated) */
+        C_MUL(&tw, f2k, st->super_twiddles[k]);
 
-    /* Unpack back to real */
-    for (int i = 0; i < ncfft; i++) {
-        timedata[2 * i] = tmp2[i].r;
-        timedata[2 * i + 1] = tmp2[i].i;
+        st->tmpbuf[k].r = f1k.r - tw.i;
+        st->tmpbuf[k].i = f1k.i + tw.r;
     }
 
-    free(tmp2);
+    /* Perform complex inverse FFT straight into the output (ncfft complex values == nfft floats) */
+    kiss_fft(st->substate, st->tmpbuf, (kiss_fft_cpx*)timedata);
 }
-
+
@@ -57,7 +57,7 @@ void kiss_fftr_free(kiss_fftr_cfg cfg);
 /* Real forward FFT: nfft real inputs -> nfft/2+1 complex outputs */
 void kiss_fftr(kiss_fftr_cfg cfg, const float* timedata, kiss_fft_cpx* freqdata);
 
-/* Real inverse FFT: nfft/2+1 complex inputs -> nfft real outputs */
+/* Real inverse FFT: nfft/2+1 complex inputs -> nfft real outputs (scaled by 1/nfft) */
 void kiss_fftri(kiss_fftr_cfg cfg, const kiss_fft_cpx* freqdata, float* timedata);
 
 #ifdef __cplusplus